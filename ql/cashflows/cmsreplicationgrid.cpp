@@ -0,0 +1,169 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/cashflows/cmsreplicationgrid.hpp>
+#include <ql/math/integrals/gaussianquadratures.hpp>
+#include <cmath>
+#include <utility>
+
+namespace QuantLib {
+
+    namespace {
+
+        // width of the panels next to the forward, in standard
+        // deviations, and growth factor of the widths in the wings
+        const Real initialWidth = 0.25;
+        const Real growthFactor = 1.5;
+        // truncation of the range for shifted lognormal sections
+        const Real truncationStdDevs = 10.0;
+
+        // panel boundaries from start to end (excluded)
+        void addBoundaries(std::vector<Real>& boundaries,
+                           Real start, Real end, Real width) {
+            const Real direction = end > start ? 1.0 : -1.0;
+            Real y = start;
+            while (direction * (end - y) > width) {
+                y += direction * width;
+                boundaries.push_back(y);
+                width *= growthFactor;
+            }
+        }
+
+    }
+
+    CmsReplicationGrid::CmsReplicationGrid(ext::shared_ptr<SmileSection> section,
+                                           Real lowerBound,
+                                           Real upperBound,
+                                           Size pointsPerPanel)
+    : section_(std::move(section)) {
+        QL_REQUIRE(section_, "no smile section given");
+        QL_REQUIRE(pointsPerPanel > 1,
+                   "at least two points per panel required, " << pointsPerPanel << " given");
+        forward_ = section_->atmLevel();
+        QL_REQUIRE(forward_ != Null<Real>(), "smile section must provide atm level");
+        lognormal_ = section_->volatilityType() == ShiftedLognormal;
+        shift_ = lognormal_ ? section_->shift() : 0.0;
+        if (lognormal_)
+            QL_REQUIRE(forward_ + shift_ > 0.0,
+                       "non-positive shifted forward (" << forward_ + shift_ << ")");
+
+        Real stdDev = std::sqrt(section_->variance(forward_));
+        if (!(stdDev > 0.0))
+            stdDev = lognormal_ ? 1.0 : 0.01;
+
+        const Real yForward = coordinate(forward_);
+        const Real yLower = (lognormal_ && lowerBound + shift_ <= 0.0) ?
+                                yForward - truncationStdDevs * stdDev :
+                                coordinate(lowerBound);
+        const Real yUpper = coordinate(upperBound);
+        QL_REQUIRE(yUpper > yLower,
+                   "upper bound (" << upperBound << ") must be greater than "
+                   "lower bound (" << lowerBound << ")");
+        lowerBound_ = strike(yLower);
+        upperBound_ = upperBound;
+
+        const Real center = std::min(std::max(yForward, yLower), yUpper);
+        std::vector<Real> below;
+        addBoundaries(below, center, yLower, initialWidth * stdDev);
+        boundaries_.push_back(yLower);
+        boundaries_.insert(boundaries_.end(), below.rbegin(), below.rend());
+        if (center > yLower && center < yUpper)
+            boundaries_.push_back(center);
+        addBoundaries(boundaries_, center, yUpper, initialWidth * stdDev);
+        boundaries_.push_back(yUpper);
+
+        GaussLegendreIntegration quadrature(pointsPerPanel);
+        const Size n = quadrature.order();
+        points_.assign(quadrature.x().begin(), quadrature.x().end());
+        weights_.assign(quadrature.weights().begin(), quadrature.weights().end());
+
+        // Legendre polynomials at the standard points
+        std::vector<Real> legendre(n * n);
+        for (Size j = 0; j < n; ++j) {
+            legendre[j] = 1.0;
+            legendre[n + j] = points_[j];
+            for (Size k = 1; k + 1 < n; ++k)
+                legendre[(k + 1) * n + j] =
+                    ((2 * k + 1) * points_[j] * legendre[k * n + j] -
+                     k * legendre[(k - 1) * n + j]) / (k + 1);
+        }
+
+        const Size panels = boundaries_.size() - 1;
+        strikes_.resize(panels * n);
+        integrationWeights_.resize(panels * n);
+        prices_.resize(panels * n);
+        coefficients_.assign(panels * n, 0.0);
+        for (Size i = 0; i < panels; ++i) {
+            const Real center = 0.5 * (boundaries_[i] + boundaries_[i + 1]);
+            const Real halfWidth = 0.5 * (boundaries_[i + 1] - boundaries_[i]);
+            const Option::Type type = center < yForward ? Option::Put : Option::Call;
+            for (Size j = 0; j < n; ++j) {
+                const Real y = center + halfWidth * points_[j];
+                const Size m = i * n + j;
+                strikes_[m] = strike(y);
+                integrationWeights_[m] = halfWidth * weights_[j] * jacobian(y);
+                prices_[m] = section_->optionPrice(strikes_[m], type);
+                for (Size k = 0; k < n; ++k)
+                    coefficients_[i * n + k] +=
+                        0.5 * (2 * k + 1) * weights_[j] * prices_[m] * legendre[k * n + j];
+            }
+        }
+    }
+
+    Real CmsReplicationGrid::coordinate(Rate strike) const {
+        return lognormal_ ? Real(std::log(strike + shift_)) : strike;
+    }
+
+    Rate CmsReplicationGrid::strike(Real coordinate) const {
+        return lognormal_ ? Real(std::exp(coordinate) - shift_) : coordinate;
+    }
+
+    Real CmsReplicationGrid::jacobian(Real coordinate) const {
+        return lognormal_ ? Real(std::exp(coordinate)) : 1.0;
+    }
+
+    Size CmsReplicationGrid::panel(Real coordinate) const {
+        const auto i = std::upper_bound(boundaries_.begin() + 1, boundaries_.end() - 1,
+                                         coordinate);
+        return i - boundaries_.begin() - 1;
+    }
+
+    Real CmsReplicationGrid::interpolate(Size panel, Real coordinate) const {
+        const Size n = points_.size();
+        const Real center = 0.5 * (boundaries_[panel] + boundaries_[panel + 1]);
+        const Real halfWidth = 0.5 * (boundaries_[panel + 1] - boundaries_[panel]);
+        const Real t = (coordinate - center) / halfWidth;
+        const Real* c = &coefficients_[panel * n];
+        Real p0 = 1.0, p1 = t;
+        Real result = c[0] + c[1] * t;
+        for (Size k = 1; k + 1 < n; ++k) {
+            const Real p2 = ((2 * k + 1) * t * p1 - k * p0) / (k + 1);
+            result += c[k + 1] * p2;
+            p0 = p1;
+            p1 = p2;
+        }
+        return result;
+    }
+
+    Real CmsReplicationGrid::optionPrice(Rate strike, Option::Type type) const {
+        if (strike < lowerBound_ || strike > upperBound_)
+            return section_->optionPrice(strike, type);
+        return interpolate(panel(coordinate(strike)), coordinate(strike)) +
+               parity(strike, type);
+    }
+
+}
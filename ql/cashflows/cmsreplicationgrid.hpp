@@ -0,0 +1,153 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file cmsreplicationgrid.hpp
+    \brief replication grid shared by cms coupons with the same fixing
+*/
+
+#ifndef quantlib_cms_replication_grid_hpp
+#define quantlib_cms_replication_grid_hpp
+
+#include <ql/option.hpp>
+#include <ql/termstructures/volatility/smilesection.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace QuantLib {
+
+    //! replication grid on a swaption smile
+    /*! The static replication of a CMS coupon, cap or floor
+        integrates the swaption prices given by the smile section of
+        its fixing date and swap tenor.  This class evaluates the
+        out-of-the-money prices of the smile section once, at the
+        Gauss-Legendre points of a set of panels covering the
+        replication range; all coupons, caps and floors with the same
+        fixing date and swap index can then be priced off the grid,
+        whatever their strike, payment date or weight function.
+
+        The panels are laid out in \f$ \log(K+s) \f$ for shifted
+        lognormal sections and in \f$ K \f$ for normal ones; they
+        start at a fraction of the at-the-money standard deviation
+        around the forward, which is always a panel boundary, and get
+        wider in the wings.  Inside a panel, the prices are given by
+        the Legendre polynomial through the values at its points, so
+        that ranges ending at any strike can be integrated without
+        further evaluations of the smile section.
+
+        \note the prices are undiscounted; call and put prices are
+              obtained from the out-of-the-money ones by put-call
+              parity with the at-the-money level of the section.
+    */
+    class CmsReplicationGrid {
+      public:
+        /*! For shifted lognormal sections, a lower bound at or below
+            minus the shift is replaced by the strike ten standard
+            deviations below the forward.
+        */
+        CmsReplicationGrid(ext::shared_ptr<SmileSection> section,
+                           Real lowerBound,
+                           Real upperBound,
+                           Size pointsPerPanel = 8);
+        //! \name Inspectors
+        //@{
+        const ext::shared_ptr<SmileSection>& smileSection() const { return section_; }
+        Real forward() const { return forward_; }
+        Real lowerBound() const { return lowerBound_; }
+        Real upperBound() const { return upperBound_; }
+        Size size() const { return strikes_.size(); }
+        //@}
+        //! \name Calculations
+        //@{
+        /*! undiscounted option price; outside the grid range, the
+            smile section is used.
+        */
+        Real optionPrice(Rate strike, Option::Type type) const;
+        /*! integral of the weighted undiscounted option prices,
+            \f$ \int_a^b w(K) V(K) \, dK \f$; the range is truncated
+            to the one of the grid.
+        */
+        template <class F>
+        Real integral(Real a, Real b, Option::Type type, const F& weight) const;
+        //@}
+      private:
+        Real coordinate(Rate strike) const;
+        Rate strike(Real coordinate) const;
+        Real jacobian(Real coordinate) const;
+        Size panel(Real coordinate) const;
+        Real interpolate(Size panel, Real coordinate) const;
+        Real parity(Rate strike, Option::Type type) const;
+
+        ext::shared_ptr<SmileSection> section_;
+        bool lognormal_;
+        Real forward_, shift_;
+        Real lowerBound_, upperBound_;
+        // standard Gauss-Legendre points and weights on [-1,1]
+        std::vector<Real> points_, weights_;
+        // panel boundaries in the grid coordinate
+        std::vector<Real> boundaries_;
+        // strikes, integration weights, out-of-the-money prices and
+        // Legendre coefficients, n per panel
+        std::vector<Real> strikes_, integrationWeights_, prices_, coefficients_;
+    };
+
+
+    // inline definitions
+
+    inline Real CmsReplicationGrid::parity(Rate strike, Option::Type type) const {
+        if (type == Option::Call)
+            return std::max(forward_ - strike, 0.0);
+        else
+            return std::max(strike - forward_, 0.0);
+    }
+
+    template <class F>
+    Real CmsReplicationGrid::integral(Real a, Real b,
+                                      Option::Type type,
+                                      const F& weight) const {
+        a = std::max(a, lowerBound_);
+        b = std::min(b, upperBound_);
+        if (b <= a)
+            return 0.0;
+
+        const Size n = points_.size();
+        const Real ya = coordinate(a), yb = coordinate(b);
+        Real result = 0.0;
+        for (Size i = panel(ya); i < boundaries_.size() - 1 && boundaries_[i] < yb; ++i) {
+            const Real lower = std::max(boundaries_[i], ya);
+            const Real upper = std::min(boundaries_[i + 1], yb);
+            if (lower == boundaries_[i] && upper == boundaries_[i + 1]) {
+                for (Size j = i * n; j < (i + 1) * n; ++j) {
+                    const Rate k = strikes_[j];
+                    result += integrationWeights_[j] * weight(k) *
+                              (prices_[j] + parity(k, type));
+                }
+            } else if (upper > lower) {
+                const Real center = 0.5 * (upper + lower), halfWidth = 0.5 * (upper - lower);
+                for (Size j = 0; j < n; ++j) {
+                    const Real y = center + halfWidth * points_[j];
+                    const Rate k = strike(y);
+                    result += halfWidth * weights_[j] * jacobian(y) * weight(k) *
+                              (interpolate(i, y) + parity(k, type));
+                }
+            }
+        }
+        return result;
+    }
+
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <ql/math/solvers1d/newton.hpp>
 #include <ql/pricingengines/blackformula.hpp>
 #include <ql/quotes/simplequote.hpp>
+#include <ql/termstructures/volatility/atmsmilesection.hpp>
 #include <ql/termstructures/volatility/smilesection.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/time/schedule.hpp>
@@ -77,9 +78,10 @@ namespace QuantLib {
 //===========================================================================//
     HaganPricer::HaganPricer(const Handle<SwaptionVolatilityStructure>& swaptionVol,
                              GFunctionFactory::YieldCurveModel modelOfYieldCurve,
-                             Handle<Quote> meanReversion)
+                             Handle<Quote> meanReversion,
+                             bool shareMarginals)
     : CmsCouponPricer(swaptionVol), modelOfYieldCurve_(modelOfYieldCurve),
-      meanReversion_(std::move(meanReversion)) {
+      meanReversion_(std::move(meanReversion)), shareMarginals_(shareMarginals) {
         registerWith(meanReversion_);
     }
 
@@ -106,12 +108,33 @@ namespace QuantLib {
 
         if (fixingDate_ > today){
             swapTenor_ = swapIndex->tenor();
-            ext::shared_ptr<VanillaSwap> swap = swapIndex->underlyingSwap(fixingDate_);
+            ext::shared_ptr<VanillaSwap> swap;
 
-            swapRateValue_ = swap->fairRate();
+            const auto key = std::make_pair(fixingDate_, swapIndex.get());
+            auto marginal = marginals_.find(key);
+            if (marginal == marginals_.end()) {
+                swap = swapIndex->underlyingSwap(fixingDate_);
 
-            static const Spread bp = 1.0e-4;
-            annuity_ = std::fabs(swap->fixedLegBPS()/bp);
+                swapRateValue_ = swap->fairRate();
+
+                static const Spread bp = 1.0e-4;
+                annuity_ = std::fabs(swap->fixedLegBPS()/bp);
+
+                vanillaOptionPricer_= ext::shared_ptr<VanillaOptionPricer>(new
+                    MarketQuotedOptionPricer(swapRateValue_, fixingDate_, swapTenor_,
+                                            *swaptionVolatility()));
+
+                if (shareMarginals_) {
+                    registerWith(swapIndex);
+                    marginals_.emplace(key, Marginal{swapIndex, swap, swapRateValue_, annuity_,
+                                                     vanillaOptionPricer_, nullptr});
+                }
+            } else {
+                swap = marginal->second.swap;
+                swapRateValue_ = marginal->second.swapRate;
+                annuity_ = marginal->second.annuity;
+                vanillaOptionPricer_ = marginal->second.vanillaOptionPricer;
+            }
 
             Size q = swapIndex->fixedLegTenor().frequency();
             const Schedule& schedule = swap->fixedSchedule();
@@ -143,9 +166,6 @@ namespace QuantLib {
                 default:
                     QL_FAIL("unknown/illegal gFunction type");
             }
-            vanillaOptionPricer_= ext::shared_ptr<VanillaOptionPricer>(new
-                MarketQuotedOptionPricer(swapRateValue_, fixingDate_, swapTenor_,
-                                        *swaptionVolatility()));
          }
     }
 
@@ -273,10 +293,37 @@ namespace QuantLib {
                                            Real lowerLimit,
                                            Real upperLimit,
                                            Real precision,
-                                           Real hardUpperLimit)
-    : HaganPricer(swaptionVol, modelOfYieldCurve, meanReversion),
+                                           Real hardUpperLimit,
+                                           Size replicationGridPoints)
+    : HaganPricer(swaptionVol, modelOfYieldCurve, meanReversion, replicationGridPoints > 0),
       lowerLimit_(lowerLimit), upperLimit_(upperLimit),
-      precision_(precision), hardUpperLimit_(hardUpperLimit) {}
+      precision_(precision), hardUpperLimit_(hardUpperLimit),
+      replicationGridPoints_(replicationGridPoints) {}
+
+    void NumericHaganPricer::initialize(const FloatingRateCoupon& coupon) {
+        HaganPricer::initialize(coupon);
+
+        replicationGrid_.reset();
+        if (replicationGridPoints_ == 0 ||
+            fixingDate_ <= Settings::instance().evaluationDate())
+            return;
+
+        // the marginal was stored by the base class
+        Marginal& marginal =
+            marginals_.at(std::make_pair(fixingDate_, coupon_->swapIndex().get()));
+        if (marginal.replicationGrid == nullptr) {
+            // the forward is the rate of the coupon's swap index, which
+            // might differ from the one the section was built with
+            auto section = ext::make_shared<AtmSmileSection>(
+                swaptionVolatility()->smileSection(fixingDate_, swapTenor_),
+                swapRateValue_);
+            Real lower = resetLowerLimit(requiredStdDeviations_);
+            Real upper = std::min(resetUpperLimit(requiredStdDeviations_), hardUpperLimit_);
+            marginal.replicationGrid = ext::make_shared<CmsReplicationGrid>(
+                section, lower, upper, replicationGridPoints_);
+        }
+        replicationGrid_ = marginal.replicationGrid;
+    }
 
     Real NumericHaganPricer::integrate(Real a, Real b, const ConundrumIntegrand& integrand) const {
 
@@ -350,6 +397,21 @@ namespace QuantLib {
             ConundrumIntegrand(vanillaOptionPricer_, rateCurve_, gFunction_,
                                fixingDate_, paymentDate_, annuity_,
                                swapRateValue_, strike, optionType));
+
+        if (replicationGrid_ != nullptr) {
+            // same replication, with the swaption prices taken from the grid
+            auto weight = [&](Real x) { return integrand->secondDerivativeOfF(x); };
+            Real integralValue =
+                annuity_ * (optionType == Option::Call ?
+                                replicationGrid_->integral(strike, replicationGrid_->upperBound(),
+                                                           optionType, weight) :
+                                replicationGrid_->integral(replicationGrid_->lowerBound(), strike,
+                                                           optionType, weight));
+            Real dFdK = integrand->firstDerivativeOfF(strike);
+            Real swaptionPrice = annuity_ * replicationGrid_->optionPrice(strike, optionType);
+            return coupon_->accrualPeriod() * (discount_/annuity_) *
+                ((1 + dFdK) * swaptionPrice + Integer(optionType) * integralValue);
+        }
         stdDeviationsForUpperLimit_= requiredStdDeviations_;
         stdDeviationsForLowerLimit_= requiredStdDeviations_;
         Real a, b, integralValue;
@@ -451,7 +513,7 @@ namespace QuantLib {
         Option::Type optionType)
     : vanillaOptionPricer_(std::move(o)), forwardValue_(forwardValue), annuity_(annuity),
       fixingDate_(fixingDate), paymentDate_(paymentDate), strike_(strike), optionType_(optionType),
-      gFunction_(std::move(gFunction)) {}
+      gFunction_(std::move(gFunction)), gForward_((*gFunction_)(forwardValue_)) {}
 
     void NumericHaganPricer::ConundrumIntegrand::setStrike(Real strike) {
         strike_ = strike;
@@ -471,19 +533,19 @@ namespace QuantLib {
 
     Real NumericHaganPricer::ConundrumIntegrand::functionF (const Real x) const {
         const Real Gx = (*gFunction_)(x);
-        const Real GR = (*gFunction_)(forwardValue_);
+        const Real GR = gForward_;
         return (x - strike_) * (Gx/GR - 1.0);
     }
 
     Real NumericHaganPricer::ConundrumIntegrand::firstDerivativeOfF (const Real x) const {
         const Real Gx = (*gFunction_)(x);
-        const Real GR = (*gFunction_)(forwardValue_) ;
+        const Real GR = gForward_;
         const Real G1 = gFunction_->firstDerivative(x);
         return (Gx/GR - 1.0) + G1/GR * (x - strike_);
     }
 
     Real NumericHaganPricer::ConundrumIntegrand::secondDerivativeOfF (const Real x) const {
-        const Real GR = (*gFunction_)(forwardValue_) ;
+        const Real GR = gForward_;
         const Real G1 = gFunction_->firstDerivative(x);
         const Real G2 = gFunction_->secondDerivative(x);
         return 2.0 * G1/GR + (x - strike_) * G2/GR;
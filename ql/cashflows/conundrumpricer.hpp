@@ -25,12 +25,16 @@
 #ifndef quantlib_conundrum_pricer_hpp
 #define quantlib_conundrum_pricer_hpp
 
+#include <ql/cashflows/cmsreplicationgrid.hpp>
 #include <ql/cashflows/couponpricer.hpp>
 #include <ql/instruments/payoffs.hpp>
+#include <map>
 
 namespace QuantLib {
 
     class CmsCoupon;
+    class SwapIndex;
+    class VanillaSwap;
     class YieldTermStructure;
     class Quote;
 
@@ -211,11 +215,17 @@ namespace QuantLib {
             registerWith(meanReversion_);
             update();
         };
+        /* */
+        void update() override {
+            marginals_.clear();
+            CmsCouponPricer::update();
+        }
 
       protected:
         HaganPricer(const Handle<SwaptionVolatilityStructure>& swaptionVol,
                     GFunctionFactory::YieldCurveModel modelOfYieldCurve,
-                    Handle<Quote> meanReversion);
+                    Handle<Quote> meanReversion,
+                    bool shareMarginals = false);
         void initialize(const FloatingRateCoupon& coupon) override;
 
         virtual Real optionletPrice(Option::Type optionType,
@@ -236,6 +246,19 @@ namespace QuantLib {
         Handle<Quote> meanReversion_;
         Period swapTenor_;
         ext::shared_ptr<VanillaOptionPricer> vanillaOptionPricer_;
+
+        /* swap, option pricer and replication grid shared by the coupons with
+           the same fixing date and swap index, if requested */
+        struct Marginal {
+            ext::shared_ptr<SwapIndex> swapIndex;
+            ext::shared_ptr<VanillaSwap> swap;
+            Rate swapRate;
+            Real annuity;
+            ext::shared_ptr<VanillaOptionPricer> vanillaOptionPricer;
+            ext::shared_ptr<CmsReplicationGrid> replicationGrid;
+        };
+        bool shareMarginals_;
+        std::map<std::pair<Date, const SwapIndex*>, Marginal> marginals_;
     };
 
 
@@ -243,6 +266,13 @@ namespace QuantLib {
     /*! Prices a cms coupon via static replication as in Hagan's
         "Conundrums..." article via numerical integration based on
         prices of vanilla swaptions
+
+        If a positive number of points per panel is passed for the
+        replication grid, the smile section of each fixing date and
+        swap index is evaluated once on a CmsReplicationGrid covering
+        the integration limits, and all coupons, caps and floors with
+        that fixing are priced off the grid instead of being
+        integrated separately.
     */
     class NumericHaganPricer : public HaganPricer {
       public:
@@ -253,7 +283,8 @@ namespace QuantLib {
             Rate lowerLimit = 0.0,
             Rate upperLimit = 1.0,
             Real precision = 1.0e-6,
-            Real hardUpperLimit = QL_MAX_REAL);
+            Real hardUpperLimit = QL_MAX_REAL,
+            Size replicationGridPoints = 0);
 
         Real upperLimit() const { return upperLimit_; }
         Real lowerLimit() const { return lowerLimit_; }
@@ -296,8 +327,10 @@ namespace QuantLib {
             Real strike_;
             const Option::Type optionType_;
             ext::shared_ptr<GFunction> gFunction_;
+            const Real gForward_;
         };
 
+        void initialize(const FloatingRateCoupon& coupon) override;
         Real integrate(Real a,
                        Real b,
                        const ConundrumIntegrand& Integrand) const;
@@ -311,6 +344,8 @@ namespace QuantLib {
         const Real  requiredStdDeviations_ = 8, precision_,
                                 refiningIntegrationTolerance_ = .0001;
         const Real hardUpperLimit_;
+        const Size replicationGridPoints_;
+        ext::shared_ptr<CmsReplicationGrid> replicationGrid_;
     };
 
     //! CMS-coupon pricer
@@ -60,6 +60,7 @@ namespace QuantLib {
       couponDiscountCurve_(std::move(couponDiscountCurve)), settings_(settings),
       volDayCounter_(swaptionVol->dayCounter()), integrator_(std::move(integrator)) {
 
+        registerWith(meanReversion_);
         if (!couponDiscountCurve_.empty())
             registerWith(couponDiscountCurve_);
 
@@ -84,10 +85,10 @@ namespace QuantLib {
         Real omega = (type == Option::Call ? 1.0 : -1.0);
         Real s1 = std::max(omega * (swapRateValue_ - strike), 0.0) *
                   (a_ * swapRateValue_ + b_);
+        Option::Type otmType = strike < swapRateValue_ ? Option::Put : Option::Call;
         Real s2 = (a_ * strike + b_) *
-                  smileSection_->optionPrice(strike, strike < swapRateValue_
-                                                         ? Option::Put
-                                                         : Option::Call);
+                  (grid_ != nullptr ? grid_->optionPrice(strike, otmType) :
+                                      smileSection_->optionPrice(strike, otmType));
         return s1 + s2;
     }
 
@@ -97,6 +98,15 @@ namespace QuantLib {
                                                               : Option::Call);
     }
 
+    Real LinearTsrPricer::integral(const Real lower, const Real upper) const {
+        // the range is on either side of the swap rate
+        if (grid_ != nullptr) {
+            Option::Type otmType = lower < swapRateValue_ ? Option::Put : Option::Call;
+            return 2.0 * a_ * grid_->integral(lower, upper, otmType, [](Real) { return 1.0; });
+        }
+        return (*integrator_)(integrand_f(this), lower, upper);
+    }
+
     void LinearTsrPricer::initialize(const FloatingRateCoupon &coupon) {
 
         coupon_ = dynamic_cast<const CmsCoupon *>(&coupon);
@@ -142,67 +152,108 @@ namespace QuantLib {
         spreadLegValue_ = spread_ * coupon_->accrualPeriod() * discountCurvePaymentDiscount_ *
                           couponDiscountRatio_;
 
+        grid_.reset();
+
         if (fixingDate_ > today_) {
 
             swapTenor_ = swapIndex_->tenor();
 
-            if (auto on = ext::dynamic_pointer_cast<OvernightIndexedSwapIndex>(swapIndex_)) {
-                swap_ = on->underlyingSwap(fixingDate_);
+            if (settings_.replicationGridPoints_ > 0) {
+                const auto key = std::make_pair(fixingDate_, swapIndex_.get());
+                auto marginal = marginals_.find(key);
+                if (marginal == marginals_.end()) {
+                    initializeMarginal();
+                    registerWith(swapIndex_);
+                    auto grid = ext::make_shared<CmsReplicationGrid>(
+                        smileSection_, adjustedLowerBound_, adjustedUpperBound_,
+                        settings_.replicationGridPoints_);
+                    marginal = marginals_
+                                   .emplace(key, Marginal{swapIndex_, swap_, swapRateValue_,
+                                                          annuity_, smileSection_,
+                                                          adjustedLowerBound_,
+                                                          adjustedUpperBound_, gamma_, gy_,
+                                                          lastDate_, lastDiscount_, grid})
+                                   .first;
+                }
+                const Marginal& m = marginal->second;
+                swap_ = m.swap;
+                swapRateValue_ = m.swapRate;
+                annuity_ = m.annuity;
+                smileSection_ = m.smileSection;
+                adjustedLowerBound_ = m.lowerBound;
+                adjustedUpperBound_ = m.upperBound;
+                gamma_ = m.gamma;
+                gy_ = m.fixedLegAnnuity;
+                lastDate_ = m.lastDate;
+                lastDiscount_ = m.lastDiscount;
+                grid_ = m.grid;
             } else {
-                swap_ = swapIndex_->underlyingSwap(fixingDate_);
+                initializeMarginal();
             }
-            swapRateValue_ = swap_->fairRate();
-            annuity_ = 1.0E4 * std::fabs(swap_->fixedLegBPS());
-            Leg swapFixedLeg = swap_->fixedLeg();
 
-            ext::shared_ptr<SmileSection> sectionTmp =
-                swaptionVolatility()->smileSection(fixingDate_, swapTenor_);
+            // compute linear model's parameters
 
-            adjustedLowerBound_ = settings_.lowerRateBound_;
-            adjustedUpperBound_ = settings_.upperRateBound_;
+            a_ = discountCurve_->discount(paymentDate_) *
+                 (gamma_ - GsrG(paymentDate_)) /
+                 (lastDiscount_ * GsrG(lastDate_) + swapRateValue_ * gy_ * gamma_);
 
-            if(sectionTmp->volatilityType() == Normal) {
-                // adjust lower bound if it was not set explicitly
-                if(settings_.defaultBounds_)
-                    adjustedLowerBound_ = std::min(adjustedLowerBound_, -adjustedUpperBound_);
-            } else {
-                // adjust bounds by section's shift
-                adjustedLowerBound_ -= sectionTmp->shift();
-                adjustedUpperBound_ -= sectionTmp->shift();
-            }
+            b_ = discountCurve_->discount(paymentDate_) / gy_ -
+                 a_ * swapRateValue_;
+        }
+    }
 
-            // if the section does not provide an atm level, we enhance it to
-            // have one, no need to exit with an exception ...
+    void LinearTsrPricer::initializeMarginal() {
 
-            if (sectionTmp->atmLevel() == Null<Real>())
-                smileSection_ = ext::make_shared<AtmSmileSection>(
-                    sectionTmp, swapRateValue_);
-            else
-                smileSection_ = sectionTmp;
+        if (auto on = ext::dynamic_pointer_cast<OvernightIndexedSwapIndex>(swapIndex_)) {
+            swap_ = on->underlyingSwap(fixingDate_);
+        } else {
+            swap_ = swapIndex_->underlyingSwap(fixingDate_);
+        }
+        swapRateValue_ = swap_->fairRate();
+        annuity_ = 1.0E4 * std::fabs(swap_->fixedLegBPS());
 
-            // compute linear model's parameters
+        ext::shared_ptr<SmileSection> sectionTmp =
+            swaptionVolatility()->smileSection(fixingDate_, swapTenor_);
 
-            Real gx = 0.0, gy = 0.0;
-            for (const auto& i : swapFixedLeg) {
-                ext::shared_ptr<Coupon> c = ext::dynamic_pointer_cast<Coupon>(i);
-                Real yf = c->accrualPeriod();
-                Date d = c->date();
-                Real pv = yf * discountCurve_->discount(d);
-                gx += pv * GsrG(d);
-                gy += pv;
-            }
+        adjustedLowerBound_ = settings_.lowerRateBound_;
+        adjustedUpperBound_ = settings_.upperRateBound_;
 
-            Real gamma = gx / gy;
-            Date lastd = swapFixedLeg.back()->date();
+        if(sectionTmp->volatilityType() == Normal) {
+            // adjust lower bound if it was not set explicitly
+            if(settings_.defaultBounds_)
+                adjustedLowerBound_ = std::min(adjustedLowerBound_, -adjustedUpperBound_);
+        } else {
+            // adjust bounds by section's shift
+            adjustedLowerBound_ -= sectionTmp->shift();
+            adjustedUpperBound_ -= sectionTmp->shift();
+        }
 
-            a_ = discountCurve_->discount(paymentDate_) *
-                 (gamma - GsrG(paymentDate_)) /
-                 (discountCurve_->discount(lastd) * GsrG(lastd) +
-                  swapRateValue_ * gy * gamma);
+        // if the section does not provide an atm level, we enhance it to
+        // have one, no need to exit with an exception ...
 
-            b_ = discountCurve_->discount(paymentDate_) / gy -
-                 a_ * swapRateValue_;
+        if (sectionTmp->atmLevel() == Null<Real>())
+            smileSection_ = ext::make_shared<AtmSmileSection>(
+                sectionTmp, swapRateValue_);
+        else
+            smileSection_ = sectionTmp;
+
+        // terms of the linear model which don't depend on the payment date
+
+        Leg swapFixedLeg = swap_->fixedLeg();
+        Real gx = 0.0;
+        gy_ = 0.0;
+        for (const auto& i : swapFixedLeg) {
+            ext::shared_ptr<Coupon> c = ext::dynamic_pointer_cast<Coupon>(i);
+            Real yf = c->accrualPeriod();
+            Date d = c->date();
+            Real pv = yf * discountCurve_->discount(d);
+            gx += pv * GsrG(d);
+            gy_ += pv;
         }
+
+        gamma_ = gx / gy_;
+        lastDate_ = swapFixedLeg.back()->date();
+        lastDiscount_ = discountCurve_->discount(lastDate_);
     }
 
     Real LinearTsrPricer::strikeFromVegaRatio(Real ratio,
@@ -353,13 +404,11 @@ namespace QuantLib {
         if (upper > lower) {
             tmpBound = std::min(upper, swapRateValue_);
             if (tmpBound > lower) {
-                result += (*integrator_)(integrand_f(this),
-                                         lower, tmpBound);
+                result += integral(lower, tmpBound);
             }
             tmpBound = std::max(lower, swapRateValue_);
             if (upper > tmpBound) {
-                result += (*integrator_)(integrand_f(this),
-                                         tmpBound, upper);
+                result += integral(tmpBound, upper);
             }
             result *= (optionType == Option::Call ? 1.0 : -1.0);
         }
@@ -25,11 +25,13 @@
 #define quantlib_lineartsr_pricer_hpp
 
 #include <ql/termstructures/volatility/smilesection.hpp>
+#include <ql/cashflows/cmsreplicationgrid.hpp>
 #include <ql/cashflows/couponpricer.hpp>
 #include <ql/instruments/payoffs.hpp>
 #include <ql/indexes/swapindex.hpp>
 #include <ql/instruments/fixedvsfloatingswap.hpp>
 #include <ql/math/integrals/integral.hpp>
+#include <map>
 
 namespace QuantLib {
 
@@ -59,6 +61,13 @@ namespace QuantLib {
         Note that for normal volatility input the lower rate bound
         is adjusted to min(-upperBound, lowerBound), except the bounds
         are set explicitly.
+
+        When a replication grid is requested in the settings, the swap
+        rate, annuity and smile section are shared by the coupons with
+        the same fixing date and swap index, and the smile section is
+        evaluated once on a CmsReplicationGrid covering the rate
+        bounds; coupons, caps and floors are then priced off the grid
+        instead of integrating the smile section for each of them.
     */
 
     class LinearTsrPricer : public CmsCouponPricer, public MeanRevertingPricer {
@@ -142,6 +151,11 @@ namespace QuantLib {
                 return *this;
             }
 
+            Settings &withReplicationGrid(const Size pointsPerPanel = 8) {
+                replicationGridPoints_ = pointsPerPanel;
+                return *this;
+            }
+
             enum Strategy {
                 RateBound,
                 VegaRatio,
@@ -155,6 +169,7 @@ namespace QuantLib {
             Real stdDevs_ = 3.0;
             Real lowerRateBound_, upperRateBound_;
             bool defaultBounds_ = true;
+            Size replicationGridPoints_ = 0;
         };
 
 
@@ -180,14 +195,21 @@ namespace QuantLib {
             registerWith(meanReversion_);
             update();
         }
-
+        /* */
+        void update() override {
+            marginals_.clear();
+            CmsCouponPricer::update();
+        }
 
       private:
 
         Real GsrG(const Date &d) const;
         Real singularTerms(Option::Type type, Real strike) const;
         Real integrand(Real strike) const;
+        Real integral(Real lower, Real upper) const;
         Real a_, b_;
+        Real gamma_, gy_, lastDiscount_;
+        Date lastDate_;
 
         class integrand_f;
 
@@ -215,7 +237,22 @@ namespace QuantLib {
             const Option::Type type_;
         };
 
+        // swap rate, annuity, smile and linear model terms shared by
+        // the coupons with the same fixing date and swap index
+        struct Marginal {
+            ext::shared_ptr<SwapIndex> swapIndex;
+            ext::shared_ptr<FixedVsFloatingSwap> swap;
+            Real swapRate, annuity;
+            ext::shared_ptr<SmileSection> smileSection;
+            Real lowerBound, upperBound;
+            Real gamma, fixedLegAnnuity;
+            Date lastDate;
+            Real lastDiscount;
+            ext::shared_ptr<CmsReplicationGrid> grid;
+        };
+
         void initialize(const FloatingRateCoupon& coupon) override;
+        void initializeMarginal();
         Real optionletPrice(Option::Type optionType, Real strike) const;
         Real strikeFromVegaRatio(Real ratio, Option::Type optionType,
                                  Real referenceStrike) const;
@@ -246,6 +283,9 @@ namespace QuantLib {
         ext::shared_ptr<Integrator> integrator_;
 
         Real adjustedLowerBound_, adjustedUpperBound_;
+
+        ext::shared_ptr<CmsReplicationGrid> grid_;
+        std::map<std::pair<Date, const SwapIndex*>, Marginal> marginals_;
     };
 }
 
@@ -32,6 +32,7 @@
 #include <ql/utilities/vectors.hpp>
 #include <utility>
 #include <algorithm>
+#include <memory>
 #include <type_traits>
 
 using std::vector;
@@ -73,6 +74,7 @@ namespace QuantLib {
                          gearing, spread,
                          refPeriodStart, refPeriodEnd,
                          dayCounter, false, exCouponDate),
+        lookbackDays_(lookbackDays),
         averagingMethod_(averagingMethod), lockoutDays_(lockoutDays),
         applyObservationShift_(applyObservationShift),
         compoundSpreadDaily_(compoundSpreadDaily),
@@ -84,8 +86,59 @@ namespace QuantLib {
         QL_REQUIRE(paymentDate >= endDate,
         "Payment date cannot be earlier than accrual end date");
 
-        const Date rateCalcStartDate = rateComputationStartDate_ == Date() ? startDate : rateComputationStartDate_;
-        const Date rateCalcEndDate = rateComputationEndDate_ == Date() ? endDate : rateComputationEndDate_;
+        QL_REQUIRE(canApplyTelescopicFormula() || !telescopicValueDates,
+                   "Telescopic formula cannot be applied for a coupon with lookback.");
+
+        if (telescopicValueDates) {
+            // the value dates depend on the current evaluation date
+            dates_ = buildDates(true);
+            n_ = dates_->dt.size();
+        } else {
+            // the dates are built when needed; here, we only need
+            // their number for the checks below
+            const Date rateCalcStartDate = rateComputationStartDate_ == Date() ? startDate : rateComputationStartDate_;
+            const Date rateCalcEndDate = rateComputationEndDate_ == Date() ? endDate : rateComputationEndDate_;
+            const auto& fixingCal = overnightIndex->fixingCalendar();
+            const Date::serial_type valueDates =
+                fixingCal.businessDaysBetween(fixingCal.adjust(rateCalcStartDate, Preceding),
+                                              fixingCal.adjust(rateCalcEndDate, Following),
+                                              true, true);
+            QL_ENSURE(valueDates>=2, "degenerate schedule");
+            n_ = valueDates - 1;
+        }
+
+        // When lockout is used the fixing rate applied for the last k days of the
+        // interest period is frozen at the rate observed k days before the period ends.
+        if (lockoutDays_ != 0) {
+            QL_REQUIRE(lockoutDays_ > 0 && lockoutDays_ < n_,
+                       "Lockout period cannot be negative or exceed the number of fixing days.");
+        }
+
+        switch (averagingMethod) {
+          case RateAveraging::Simple:
+            QL_REQUIRE(
+                fixingDays_ == overnightIndex->fixingDays() && !applyObservationShift_ && lockoutDays_ == 0,
+                "Cannot price an overnight coupon with simple averaging with lookback or lockout.");
+            setPricer(ext::make_shared<ArithmeticAveragedOvernightIndexedCouponPricer>(telescopicValueDates));
+            break;
+          case RateAveraging::Compound:
+            setPricer(ext::make_shared<CompoundingOvernightIndexedCouponPricer>());
+            break;
+          default:
+            QL_FAIL("unknown compounding convention (" << Integer(averagingMethod) << ")");
+        }
+    }
+
+    std::shared_ptr<const OvernightIndexedCoupon::Dates>
+    OvernightIndexedCoupon::buildDates(bool telescopicValueDates) const {
+        auto dates = std::make_shared<Dates>();
+        vector<Date>& valueDates = dates->valueDates;
+        vector<Date>& interestDates = dates->interestDates;
+        vector<Date>& fixingDates = dates->fixingDates;
+        vector<Time>& dt = dates->dt;
+
+        const Date rateCalcStartDate = rateComputationStartDate_ == Date() ? accrualStartDate_ : rateComputationStartDate_;
+        const Date rateCalcEndDate = rateComputationEndDate_ == Date() ? accrualEndDate_ : rateComputationEndDate_;
         // value dates
         Date tmpEndDate = rateCalcEndDate;
 
@@ -97,10 +150,7 @@ namespace QuantLib {
            a grace period of 7 business after the evaluation date). This will
            lead to false coupon projections (see the warning the class header). */
 
-        QL_REQUIRE(canApplyTelescopicFormula() || !telescopicValueDates,
-                   "Telescopic formula cannot be applied for a coupon with lookback.");
-
-        const auto& fixingCal = overnightIndex->fixingCalendar();
+        const auto& fixingCal = index_->fixingCalendar();
         if (telescopicValueDates) {
             // build optimised value dates schedule: front stub goes from rateCalcStartDate
             // to min(max(rateCalcStartDate,evalDate) + 7bd, rateCalcEndDate)
@@ -109,7 +159,7 @@ namespace QuantLib {
                 std::max(rateCalcStartDate, evalDate), 7, Days, Following);
             tmpEndDate = std::min(tmpEndDate, rateCalcEndDate);
         }
-        valueDates_ = fixingCal.businessDayList(
+        valueDates = fixingCal.businessDayList(
             fixingCal.adjust(rateCalcStartDate, Preceding),
             fixingCal.adjust(tmpEndDate, Following));
 
@@ -119,75 +169,77 @@ namespace QuantLib {
             tmpEndDate = fixingCal.adjust(rateCalcEndDate, Following);
             const Date tmpLockoutDate = fixingCal.advance(rateCalcEndDate,
                 -std::max<Integer>(lockoutDays_, 1), Days);
-            Date nextValueDate = tmpLockoutDate > valueDates_.back()
+            Date nextValueDate = tmpLockoutDate > valueDates.back()
                                  ? tmpLockoutDate
-                                 : fixingCal.advance(valueDates_.back(), 1, Days);
+                                 : fixingCal.advance(valueDates.back(), 1, Days);
             while (nextValueDate <= tmpEndDate) {
-                valueDates_.push_back(nextValueDate);
+                valueDates.push_back(nextValueDate);
                 nextValueDate = fixingCal.advance(nextValueDate, 1, Days);
             }
         }
 
-        QL_ENSURE(valueDates_.size()>=2, "degenerate schedule");
+        QL_ENSURE(valueDates.size()>=2, "degenerate schedule");
 
-        n_ = valueDates_.size() - 1;
+        const Size n = valueDates.size() - 1;
 
-        interestDates_ = valueDates_;
-        interestDates_.front() = rateCalcStartDate;
-        interestDates_.back() = rateCalcEndDate;
+        interestDates = valueDates;
+        interestDates.front() = rateCalcStartDate;
+        interestDates.back() = rateCalcEndDate;
 
-        if (fixingDays_ == overnightIndex->fixingDays() && fixingDays_ == 0) {
-            fixingDates_ = vector<Date>(valueDates_.begin(), valueDates_.end() - 1);
+        if (fixingDays_ == index_->fixingDays() && fixingDays_ == 0) {
+            fixingDates = vector<Date>(valueDates.begin(), valueDates.end() - 1);
         } else {
             // Lookback (fixing days) without observation shift:
             // The date that the fixing rate is pulled  from (the observation date) is k
             // business days before the date that interest is applied (the interest date)
             // and is applied for the number of calendar days until the next business
             // day following the interest date.
-            fixingDates_.resize(n_);
-            for (Size i = 0; i <= n_; ++i) {
-                Date tmp = applyLookbackPeriod(overnightIndex, valueDates_[i], fixingDays_);
-                if (i < n_)
-                    fixingDates_[i] = tmp;
-                if (fixingDays_ != overnightIndex->fixingDays())
+            fixingDates.resize(n);
+            for (Size i = 0; i <= n; ++i) {
+                Date tmp = applyLookbackPeriod(index_, valueDates[i], fixingDays_);
+                if (i < n)
+                    fixingDates[i] = tmp;
+                if (fixingDays_ != index_->fixingDays())
                     // If fixing dates of the coupon deviate from fixing days in the index
                     // we need to correct the value dates such that they reflect dates
                     // corresponding to a deposit instrument linked to the index.
                     // This is to ensure that future projections (which are computed
                     // based on the value dates) of the index do not
                     // yield any convexity corrections.
-                    valueDates_[i] = overnightIndex->valueDate(tmp);
+                    valueDates[i] = index_->valueDate(tmp);
             }
         }
         // When lockout is used the fixing rate applied for the last k days of the
         // interest period is frozen at the rate observed k days before the period ends.
         if (lockoutDays_ != 0) {
-            QL_REQUIRE(lockoutDays_ > 0 && lockoutDays_ < n_,
+            QL_REQUIRE(lockoutDays_ > 0 && lockoutDays_ < n,
                        "Lockout period cannot be negative or exceed the number of fixing days.");
-            const Date lockoutDate = fixingDates_[n_ - 1 - lockoutDays_];
-            std::fill(fixingDates_.end() - lockoutDays_, fixingDates_.end(), lockoutDate);
+            const Date lockoutDate = fixingDates[n - 1 - lockoutDays_];
+            std::fill(fixingDates.end() - lockoutDays_, fixingDates.end(), lockoutDate);
         }
 
         // accrual (compounding) periods
-        dt_.resize(n_);
-        const DayCounter& dc = overnightIndex->dayCounter();
-        const auto& accrualDates = (applyObservationShift_ && lookbackDays > 0) ? valueDates_ : interestDates_;
-        for (Size i = 0; i < n_; ++i)
-            dt_[i] = dc.yearFraction(accrualDates[i], accrualDates[i + 1]);
-
-        switch (averagingMethod) {
-          case RateAveraging::Simple:
-            QL_REQUIRE(
-                fixingDays_ == overnightIndex->fixingDays() && !applyObservationShift_ && lockoutDays_ == 0,
-                "Cannot price an overnight coupon with simple averaging with lookback or lockout.");
-            setPricer(ext::make_shared<ArithmeticAveragedOvernightIndexedCouponPricer>(telescopicValueDates));
-            break;
-          case RateAveraging::Compound:
-            setPricer(ext::make_shared<CompoundingOvernightIndexedCouponPricer>());
-            break;
-          default:
-            QL_FAIL("unknown compounding convention (" << Integer(averagingMethod) << ")");
+        dt.resize(n);
+        const DayCounter& dc = index_->dayCounter();
+        const auto& accrualDates = (applyObservationShift_ && lookbackDays_ > 0) ? valueDates : interestDates;
+        for (Size i = 0; i < n; ++i)
+            dt[i] = dc.yearFraction(accrualDates[i], accrualDates[i + 1]);
+
+        return dates;
+    }
+
+    const OvernightIndexedCoupon::Dates& OvernightIndexedCoupon::dates() const {
+        std::shared_ptr<const Dates> dates = std::atomic_load(&dates_);
+        if (!dates) {
+            // concurrent readers might both build the dates; only the
+            // first ones are stored, and they're never replaced so that
+            // the references returned by the inspectors stay valid.
+            std::shared_ptr<const Dates> stored;
+            dates = buildDates(false);
+            if (!std::atomic_compare_exchange_strong(&dates_, &stored, dates))
+                dates = stored;
         }
+        return *dates;
     }
 
     Real OvernightIndexedCoupon::accruedAmount(const Date& d) const {
@@ -213,9 +265,10 @@ namespace QuantLib {
     }
 
     const vector<Rate>& OvernightIndexedCoupon::indexFixings() const {
+        const vector<Date>& fixingDates = this->fixingDates();
         fixings_.resize(n_);
         for (Size i=0; i<n_; ++i)
-            fixings_[i] = index_->fixing(fixingDates_[i]);
+            fixings_[i] = index_->fixing(fixingDates[i]);
         return fixings_;
     }
 
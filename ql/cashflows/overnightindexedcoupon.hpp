@@ -51,6 +51,11 @@ namespace QuantLib {
         to true unless you know exactly what you are doing. The intended use is
         rather by the OISRateHelper which is safe, since it reinitialises the
         instrument each time the evaluation date changes.
+
+        Unless telescopic value dates are used, the daily fixing, value and
+        interest dates are only built when first needed (e.g., when the
+        coupon is priced) so that large books of coupons don't store them
+        until they're used.  Building them is safe for concurrent readers.
     */
     class OvernightIndexedCoupon : public FloatingRateCoupon {
       public:
@@ -77,15 +82,15 @@ namespace QuantLib {
         //! \name Inspectors
         //@{
         //! fixing dates for the rates to be compounded
-        const std::vector<Date>& fixingDates() const { return fixingDates_; }
+        const std::vector<Date>& fixingDates() const { return dates().fixingDates; }
         //! accrual (compounding) periods
-        const std::vector<Time>& dt() const { return dt_; }
+        const std::vector<Time>& dt() const { return dates().dt; }
         //! fixings to be compounded
         const std::vector<Rate>& indexFixings() const;
         //! value dates for the rates to be compounded
-        const std::vector<Date>& valueDates() const { return valueDates_; }
+        const std::vector<Date>& valueDates() const { return dates().valueDates; }
         //! interest dates for the rates to be compounded
-        const std::vector<Date>& interestDates() const { return interestDates_; }
+        const std::vector<Date>& interestDates() const { return dates().interestDates; }
         //! averaging method
         RateAveraging::Type averagingMethod() const { return averagingMethod_; }
         //! lockout days
@@ -109,7 +114,7 @@ namespace QuantLib {
         //! \name FloatingRateCoupon interface
         //@{
         //! the date when the coupon is fully determined
-        Date fixingDate() const override { return fixingDates_.back(); }
+        Date fixingDate() const override { return fixingDates().back(); }
         Real accruedAmount(const Date&) const override;
         //@}
         //! \name Visitability
@@ -128,10 +133,15 @@ namespace QuantLib {
         }
         //@}
       private:
-        std::vector<Date> valueDates_, interestDates_, fixingDates_;
+        struct Dates {
+            std::vector<Date> valueDates, interestDates, fixingDates;
+            std::vector<Time> dt;
+        };
+        // std::shared_ptr for the atomic operations used in dates()
+        mutable std::shared_ptr<const Dates> dates_;
         mutable std::vector<Rate> fixings_;
         Size n_;
-        std::vector<Time> dt_;
+        Natural lookbackDays_;
         RateAveraging::Type averagingMethod_;
         Natural lockoutDays_;
         bool applyObservationShift_;
@@ -139,6 +149,8 @@ namespace QuantLib {
         Date rateComputationStartDate_, rateComputationEndDate_;
 
         Rate averageRate(const Date& date) const;
+        const Dates& dates() const;
+        std::shared_ptr<const Dates> buildDates(bool telescopicValueDates) const;
     };
 
     //! capped floored overnight indexed coupon
@@ -23,6 +23,8 @@
 */
 
 #include <ql/cashflows/overnightindexedcouponpricer.hpp>
+#include <ql/indexes/overnightfixingaccumulator.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -34,6 +36,34 @@ namespace QuantLib {
             return std::lower_bound(interestDates.begin(), interestDates.end()-1, date) -
                      interestDates.begin();
         }
+
+        /* Returns the end of the range [1, end) of past fixings whose
+           contributions can be read from the cumulative values stored
+           by the index, and sets the position of the first one; zero
+           is returned if the range is empty.  The first and the last
+           fixing are excluded since their accrual periods might be
+           broken, and so are the fixings in the lockout period.
+        */
+        Size accumulatedFixingsEnd(const OvernightIndexedCoupon& coupon,
+                                   const OvernightIndex& index,
+                                   Size fixed, Size n, Size& position) {
+            const auto& fixingDates = coupon.fixingDates();
+            if (coupon.fixingDays() != index.fixingDays() || fixed < 3)
+                return 0;
+            const Size end = std::min({fixed, n - 1, fixingDates.size() - coupon.lockoutDays()});
+            if (end < 3)
+                return 0;
+            // the coupon and index fixings are the same business days
+            // if they have the same number and the same endpoints
+            const Size count = end - 1;
+            const OvernightFixingAccumulator& accumulator = index.fixingAccumulator();
+            position = accumulator.position(fixingDates[1]);
+            if (position == Null<Size>() || position + count > accumulator.size() ||
+                accumulator.date(position + count - 1) != fixingDates[end - 1] ||
+                !accumulator.hasFixings(position, count))
+                return 0;
+            return end;
+        }
     }
 
     OvernightIndexedCouponPricer::OvernightIndexedCouponPricer(
@@ -126,8 +156,24 @@ namespace QuantLib {
 
         Real compoundFactor = 1.0, compoundFactorWithoutSpread = 1.0;
 
-        // already fixed part
+        // already fixed part; the growth factors of the fixings in
+        // [1, accumulatedEnd) are compounded in a single step
+        const Size fixed =
+            std::lower_bound(fixingDates.begin(), fixingDates.begin() + n, today) -
+            fixingDates.begin();
+        Size position = Null<Size>();
+        const Size accumulatedEnd =
+            (!compoundSpreadDaily || couponSpread == 0.0)
+                ? accumulatedFixingsEnd(*coupon_, *index, fixed, n, position)
+                : 0;
         while (i < n && fixingDates[i] < today) {
+            if (i == 1 && accumulatedEnd > 1) {
+                const Real gf = index->fixingAccumulator().compoundFactor(position, accumulatedEnd - 1);
+                compoundFactorWithoutSpread *= gf;
+                compoundFactor *= gf;
+                i = accumulatedEnd;
+                continue;
+            }
             // rate must have been fixed
             Rate fixing = pastFixings[fixingDates[i]];
             QL_REQUIRE(fixing != Null<Real>(),
@@ -244,9 +290,20 @@ namespace QuantLib {
 
         const auto& pastFixings = index->timeSeries();
 
-        // already fixed part
+        // already fixed part; the contributions of the fixings in
+        // [1, accumulatedEnd) are added in a single step
         Date today = Settings::instance().evaluationDate();
+        const Size fixed =
+            std::lower_bound(fixingDates.begin(), fixingDates.begin() + n, today) -
+            fixingDates.begin();
+        Size position = Null<Size>();
+        const Size accumulatedEnd = accumulatedFixingsEnd(*coupon_, *index, fixed, n, position);
         while (i < n && fixingDates[i] < today) {
+            if (i == 1 && accumulatedEnd > 1) {
+                accumulatedRate += index->fixingAccumulator().accumulatedRate(position, accumulatedEnd - 1);
+                i = accumulatedEnd;
+                continue;
+            }
             // rate must have been fixed
             Rate pastFixing = pastFixings[fixingDates[i]];
             QL_REQUIRE(pastFixing != Null<Real>(),
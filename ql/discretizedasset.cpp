@@ -22,6 +22,12 @@
 
 namespace QuantLib {
 
+    void Lattice::jointRollback(const std::vector<DiscretizedAsset*>& assets,
+                                Time to) const {
+        for (auto* asset : assets)
+            rollback(*asset, to);
+    }
+
     void DiscretizedOption::postAdjustValuesImpl() {
         /* In the real world, with time flowing forward, first
            any payment is settled and only after options can be
@@ -166,6 +166,9 @@ namespace QuantLib {
           exerciseTimes_(std::move(exerciseTimes)) {}
         void reset(Size size) override;
         std::vector<Time> mandatoryTimes() const override;
+        const ext::shared_ptr<DiscretizedAsset>& underlying() const {
+            return underlying_;
+        }
 
       protected:
         void postAdjustValuesImpl() override;
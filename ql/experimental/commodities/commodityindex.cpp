@@ -39,6 +39,7 @@ namespace QuantLib {
       nearbyOffset_(nearbyOffset) {
         registerWith(Settings::instance().evaluationDate());
         registerWith(notifier());
+        resolveHistoryHandle();
 
         if (forwardCurve_ != nullptr)
             // registerWith(forwardCurve_);
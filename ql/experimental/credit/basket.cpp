@@ -327,6 +327,16 @@ namespace QuantLib {
         return cumulatedLoss() + lossModel_->expectedTrancheLoss(d);
     }
 
+    std::vector<Real> Basket::expectedTrancheLosses(
+                                      const std::vector<Date>& dates) const {
+        calculate();
+        std::vector<Real> losses = lossModel_->expectedTrancheLosses(dates);
+        const Real realizedLoss = cumulatedLoss();
+        for (Real& loss : losses)
+            loss += realizedLoss;
+        return losses;
+    }
+
     std::vector<Real> Basket::splitVaRLevel(const Date& date, Real loss) const {
         calculate();
         return lossModel_->splitVaRLevel(date, loss);
@@ -228,6 +228,12 @@ namespace QuantLib {
         */
         //@{
         Real expectedTrancheLoss(const Date& d) const;
+        /*! Expected tranche losses at several dates; depending on the
+            model, this can be faster than several calls to
+            expectedTrancheLoss.
+        */
+        std::vector<Real> expectedTrancheLosses(
+            const std::vector<Date>& dates) const;
         /*! The lossFraction is the fraction of losses expressed in 
             inception (no losses) tranche units (e.g. 'attach level'=0%, 
             'detach level'=100%)
@@ -58,10 +58,29 @@ namespace QuantLib {
         { 
             QL_REQUIRE(copula->numFactors() == 1, 
                 "Inhomogeneous model not implemented for multifactor");
+            QL_REQUIRE(nSteps > 0, "at least one integration step required");
         }
     protected:
-        Distribution lossDistrib(const Date& d) const;
+        Distribution lossDistrib(const Date& d) const {
+            return lossDistrib(std::vector<Date>(1, d)).front();
+        }
+        /*! Loss distributions at several dates, calculated in a single
+            integration over the market factor; the factor nodes are
+            processed in parallel when QuantLib is compiled with OpenMP
+            support.
+        */
+        std::vector<Distribution> lossDistrib(
+                                        const std::vector<Date>& dates) const;
     public:
+      std::vector<Real> expectedTrancheLosses(
+                                const std::vector<Date>& dates) const override {
+          std::vector<Distribution> dists = lossDistrib(dates);
+          std::vector<Real> losses(dates.size());
+          for (Size t=0; t<dates.size(); t++)
+              losses[t] = dists[t].cumulativeExcessProbability(attachAmount_,
+                                                               detachAmount_);
+          return losses;
+      }
       Real expectedTrancheLoss(const Date& d) const override {
           return lossDistrib(d).cumulativeExcessProbability(attachAmount_, detachAmount_);
           // This one if the distribution is over the whole loss structure:
@@ -120,47 +139,18 @@ namespace QuantLib {
     }
 
     template<class CP>
-    Distribution HomogeneousPoolLossModel<CP>::lossDistrib(
-        const Date& d) const 
+    std::vector<Distribution> HomogeneousPoolLossModel<CP>::lossDistrib(
+        const std::vector<Date>& dates) const
     {
-        LossDistHomogeneous bucktLDistBuff(nBuckets_, detachAmount_);
-
-        std::vector<Real> lgd;// switch to a mutable cache member
-        std::vector<Real> recoveries = copula_->recoveries();
-        std::transform(recoveries.begin(), recoveries.end(), 
-                       std::back_inserter(lgd),
-                       [](Real x) -> Real { return 1.0-x; });
-        std::transform(lgd.begin(), lgd.end(), notionals_.begin(), 
-            lgd.begin(), std::multiplies<>());
-        std::vector<Real> prob = basket_->remainingProbabilities(d);
-        for(Size iName=0; iName<prob.size(); iName++)
-            prob[iName] = copula_->inverseCumulativeY(prob[iName], iName);
-
-        // integrate locally (1 factor). 
-        // use explicitly a 1D latent model object? 
-        Distribution dist(nBuckets_, 0.0, 
-            detachAmount_);
-            //notional_);
-        std::vector<Real> mkft(1, min_ + delta_ /2.);
-        for (Size i = 0; i < nSteps_; i++) {
-            std::vector<Real> conditionalProbs;
-            conditionalProbs.reserve(notionals_.size());
-            for(Size iName=0; iName<notionals_.size(); iName++)
-                conditionalProbs.push_back(
-                copula_->conditionalDefaultProbabilityInvP(prob[iName], iName, 
-                    mkft));
-            Distribution bld = bucktLDistBuff(lgd, conditionalProbs);
-            Real densitydm = delta_ * copula_->density(mkft);
-            // also, instead of calling the static method it could be wrapped 
-            // through an inlined call in the latent model
-            for (Size j = 0; j < nBuckets_; j++)
-                dist.addDensity(j, bld.density(j) * densitydm);
-            mkft[0] += delta_;
-        }
-        return dist;
+        std::vector<std::vector<Probability> > prob(dates.size());
+        for (Size t=0; t<dates.size(); t++)
+            prob[t] = basket_->remainingProbabilities(dates[t]);
+        // integrate locally (1 factor).
+        return detail::oneFactorPoolLossDistributions<LossDistHomogeneous>(
+            *copula_, notionals_, prob, min_, delta_, nSteps_,
+            nBuckets_, detachAmount_);
     }
 
-
 }
 
 #endif
@@ -42,36 +42,55 @@ namespace QuantLib {
         const Real inceptionTrancheNotional = 
             arguments_.basket->trancheNotional();
 
-        // compute expected loss at the beginning of first relevant period
-        Real e1 = 0;
+        // collect the dates at which the expected loss is needed, so
+        // that the loss model can calculate all of them in one call
+        std::vector<Date> lossDates;
+        std::vector<std::vector<Date> > steps(arguments_.normalizedLeg.size());
         // todo add includeSettlement date flows variable to engine.
         if (!arguments_.normalizedLeg[0]->hasOccurred(today)) 
              // cast to fixed rate coupon?
-            e1 = arguments_.basket->expectedTrancheLoss(
-                ext::dynamic_pointer_cast<Coupon>(
-                    arguments_.normalizedLeg[0])->accrualStartDate()); 
+            lossDates.push_back(ext::dynamic_pointer_cast<Coupon>(
+                arguments_.normalizedLeg[0])->accrualStartDate());
+        for (Size k=0; k<arguments_.normalizedLeg.size(); ++k) {
+            if (arguments_.normalizedLeg[k]->hasOccurred(today))
+                continue;
+            const ext::shared_ptr<Coupon> coupon =
+                ext::dynamic_pointer_cast<Coupon>(arguments_.normalizedLeg[k]);
+            Date d, d0 = coupon->accrualStartDate(), d2 = coupon->date();
+            do {
+                d = NullCalendar().advance(d0 > today ? d0 : today,
+                                           stepSize_);
+                if (d > d2) d = d2;
+                steps[k].push_back(d);
+                lossDates.push_back(d);
+                d0 = d;
+            }
+            while (d < d2);
+        }
+        const std::vector<Real> losses =
+            arguments_.basket->expectedTrancheLosses(lossDates);
+        auto loss = losses.begin();
+
+        // compute expected loss at the beginning of first relevant period
+        Real e1 = 0;
+        if (!arguments_.normalizedLeg[0]->hasOccurred(today)) 
+            e1 = *loss++;
         results_.expectedTrancheLoss.push_back(e1);// zero or realized losses?
 
-        for (auto& i : arguments_.normalizedLeg) {
-            if (i->hasOccurred(today)) {
+        for (Size k=0; k<arguments_.normalizedLeg.size(); ++k) {
+            if (arguments_.normalizedLeg[k]->hasOccurred(today)) {
                 // add includeSettlement date flows variable to engine.
                 results_.expectedTrancheLoss.push_back(0.);
                 continue;
             }
 
-            const ext::shared_ptr<Coupon> coupon = ext::dynamic_pointer_cast<Coupon>(i);
+            const ext::shared_ptr<Coupon> coupon =
+                ext::dynamic_pointer_cast<Coupon>(arguments_.normalizedLeg[k]);
 
-            Date d1 = coupon->accrualStartDate();
-            Date d2 = coupon->date();
-
-            Date d, d0 = d1;
-            Real e2;
-            do {
-                d = NullCalendar().advance(d0 > today ? d0 : today,
-                                           stepSize_);
-                if (d > d2) d = d2;
-
-                e2 = arguments_.basket->expectedTrancheLoss(d);
+            Date d0 = coupon->accrualStartDate();
+            Real e2 = e1;
+            for (const Date& d : steps[k]) {
+                e2 = *loss++;
 
                 results_.premiumValue
                     // ..check for e2 including past/realized losses
@@ -90,7 +109,6 @@ namespace QuantLib {
                 d0 = d;
                 e1 = e2;
             }
-            while (d < d2);
             results_.expectedTrancheLoss.push_back(e2);
         }
 
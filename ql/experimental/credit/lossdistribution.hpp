@@ -27,6 +27,8 @@
 #include <ql/math/distributions/binomialdistribution.hpp>
 #include <ql/experimental/credit/distribution.hpp>
 #include <ql/experimental/credit/onefactorcopula.hpp>
+#include <algorithm>
+#include <exception>
 
 namespace QuantLib {
 
@@ -209,6 +211,86 @@ namespace QuantLib {
         Real epsilon_;
     };
 
+    namespace detail {
+
+        /* Loss distributions of a one-factor pool at several dates,
+           integrated over the market factor with the midpoint rule;
+           LossDistType is the algorithm convolving the conditional
+           default probabilities at each node.
+
+           The factor nodes are split into a fixed number of contiguous
+           blocks, which are processed in parallel; each block adds up
+           the densities of its nodes, and the blocks are then added in
+           order, so that the results don't depend on the number of
+           threads.
+        */
+        template <class LossDistType, class LatentModel>
+        std::vector<Distribution> oneFactorPoolLossDistributions(
+                const LatentModel& copula,
+                const std::vector<Real>& notionals,
+                const std::vector<std::vector<Probability> >& probabilities,
+                Real min, Real delta, Size nSteps,
+                Size nBuckets, Real maximum) {
+            QL_REQUIRE(nSteps > 0, "at least one integration step required");
+
+            std::vector<Real> recoveries = copula.recoveries();
+            std::vector<Real> lgd(notionals.size());
+            for (Size iName=0; iName<notionals.size(); iName++)
+                lgd[iName] = (1.0 - recoveries[iName]) * notionals[iName];
+            const Size nDates = probabilities.size();
+            std::vector<std::vector<Real> > invProbs(probabilities);
+            for (Size t=0; t<nDates; t++)
+                for (Size iName=0; iName<invProbs[t].size(); iName++)
+                    invProbs[t][iName] =
+                        copula.inverseCumulativeY(invProbs[t][iName], iName);
+
+            const Size nBlocks = std::min<Size>(nSteps, 16);
+            const Size stepsPerBlock = (nSteps + nBlocks - 1) / nBlocks;
+            std::vector<std::vector<Distribution> > blockDists(nBlocks,
+                std::vector<Distribution>(nDates,
+                    Distribution(nBuckets, 0.0, maximum)));
+            std::exception_ptr error;
+            #pragma omp parallel for if(nBlocks > 1)
+            for (long b = 0; b < long(nBlocks); b++) {
+                try {
+                    // the loss algorithm might keep state; one per block
+                    LossDistType lossDist(nBuckets, maximum);
+                    std::vector<Real> conditionalProbs(notionals.size());
+                    const Size last = std::min(nSteps, (b + 1) * stepsPerBlock);
+                    for (Size i = b * stepsPerBlock; i < last; i++) {
+                        std::vector<Real> mkft(1, min + delta * (i + 0.5));
+                        Real densitydm = delta * copula.density(mkft);
+                        for (Size t = 0; t < nDates; t++) {
+                            for (Size iName=0; iName<notionals.size(); iName++)
+                                conditionalProbs[iName] =
+                                    copula.conditionalDefaultProbabilityInvP(
+                                        invProbs[t][iName], iName, mkft);
+                            Distribution nodeDist =
+                                lossDist(lgd, conditionalProbs);
+                            for (Size j = 0; j < nBuckets; j++)
+                                blockDists[b][t].addDensity(
+                                    j, nodeDist.density(j) * densitydm);
+                        }
+                    }
+                } catch (...) {
+                    #pragma omp critical
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+                std::rethrow_exception(error);
+
+            std::vector<Distribution> dists = blockDists[0];
+            for (Size b = 1; b < nBlocks; b++)
+                for (Size t = 0; t < nDates; t++)
+                    for (Size j = 0; j < nBuckets; j++)
+                        dists[t].addDensity(j, blockDists[b][t].density(j));
+            return dists;
+        }
+
+    }
+
 }
 
 #endif
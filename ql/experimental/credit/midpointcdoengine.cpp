@@ -42,17 +42,30 @@ namespace QuantLib {
         const Real inceptionTrancheNotional = 
             arguments_.basket->trancheNotional();
 
-        // compute expected loss at the beginning of first relevant period
-        Real e1 = 0;
+        // collect the dates at which the expected loss is needed, so
+        // that the loss model can calculate all of them in one call
+        std::vector<Date> lossDates;
         // todo add includeSettlement date flows variable to engine.
         if (!arguments_.normalizedLeg[0]->hasOccurred(today))
             // Notice that since there might be a gap between the end of 
             // acrrual and payment dates and today be in between
             // the tranche loss on that date might not be contingent but 
             // realized:
-            e1 = arguments_.basket->expectedTrancheLoss(
-                ext::dynamic_pointer_cast<Coupon>(
-                    arguments_.normalizedLeg[0])->accrualStartDate());
+            lossDates.push_back(ext::dynamic_pointer_cast<Coupon>(
+                arguments_.normalizedLeg[0])->accrualStartDate());
+        for (auto& i : arguments_.normalizedLeg) {
+            if (!i->hasOccurred(today))
+                lossDates.push_back(
+                    ext::dynamic_pointer_cast<Coupon>(i)->accrualEndDate());
+        }
+        const std::vector<Real> losses =
+            arguments_.basket->expectedTrancheLosses(lossDates);
+        auto loss = losses.begin();
+
+        // compute expected loss at the beginning of first relevant period
+        Real e1 = 0;
+        if (!arguments_.normalizedLeg[0]->hasOccurred(today))
+            e1 = *loss++;
         results_.expectedTrancheLoss.push_back(e1);
         //'e1'  should contain the existing loses.....? use remaining amounts?
         for (auto& i : arguments_.normalizedLeg) {
@@ -68,7 +81,7 @@ namespace QuantLib {
             // we assume the loss within the period took place on this date:
             Date defaultDate = startDate + (endDate-startDate)/2;
 
-            Real e2 = arguments_.basket->expectedTrancheLoss(endDate);
+            Real e2 = *loss++;
             results_.expectedTrancheLoss.push_back(e2);
             results_.premiumValue += 
                 ((inceptionTrancheNotional - e2) / inceptionTrancheNotional)
@@ -869,10 +869,22 @@ namespace QuantLib {
             Date maxHorizonDate = today  + Period(this->maxHorizon_, Days);
 
             const ext::shared_ptr<Pool>& pool = this->basket_->pool();
-            for(Size iName=0; iName < this->basket_->size(); ++iName)//use'live'
+            horizonDefaultPs_.clear();
+            horizonThresholds_.clear();
+            for(Size iName=0; iName < this->basket_->size(); ++iName) {//use'live'
                 horizonDefaultPs_.push_back(pool->get(pool->names()[iName]).
                     defaultProbability(this->basket_->defaultKeys()[iName])
                         ->defaultProbability(maxHorizonDate, true));
+                /* Latent variable values above the threshold can not
+                  lead to a default before the horizon; the probability
+                  is widened to be safe against the accuracy of the
+                  inversion, the exact test is done on the names below.
+                */
+                Probability p = horizonDefaultPs_.back() * (1. + 1.e-4)
+                    + 1.e-12;
+                horizonThresholds_.push_back(p < 1. ?
+                    model_->inverseCumulativeY(p, iName) : QL_MAX_REAL);
+            }
         }
         Real getEventRecovery(const defaultSimEvent& evt) const {
             return recoveries_[evt.nameIdx];
@@ -910,6 +922,10 @@ namespace QuantLib {
         // Default probabilities for each name at the time of the maximun
         //   horizon date. Cached for perf.
         mutable std::vector<Probability> horizonDefaultPs_;
+        // Latent variable values corresponding to the probabilities above.
+        mutable std::vector<Real> horizonThresholds_;
+        // Buffer for the latent variable values of a sample.
+        mutable std::vector<Real> latentVarSamples_;
     };
 
 
@@ -924,9 +940,13 @@ namespace QuantLib {
         // starts with no events
         this->simsBuffer_.push_back(std::vector<defaultSimEvent> ());
 
+        // all the latent variables at once, then only the names which
+        //   might have defaulted go through the distribution
+        model_->latentVarValues(values, latentVarSamples_);
         for(Size iName=0; iName<model_->size(); iName++) {
-            Real latentVarSample =
-                model_->latentVarValue(values, iName);
+            Real latentVarSample = latentVarSamples_[iName];
+            if (latentVarSample > horizonThresholds_[iName])
+                continue;
             Probability simDefaultProb =
                model_->cumulativeY(latentVarSample, iName);
             // If the default simulated lies before the max date:
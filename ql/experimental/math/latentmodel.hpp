@@ -24,6 +24,7 @@
 #include <ql/experimental/math/multidimquadrature.hpp>
 #include <ql/experimental/math/multidimintegrator.hpp>
 #include <ql/math/integrals/trapezoidintegral.hpp>
+#include <ql/math/matrix.hpp>
 #include <ql/math/randomnumbers/randomsequencegenerator.hpp>
 #include <ql/experimental/math/gaussiancopulapolicy.hpp>
 #include <ql/experimental/math/tcopulapolicy.hpp>
@@ -81,6 +82,15 @@ namespace QuantLib {
             const std::vector<Real>& arg)>& f) const {
             QL_FAIL("No vector integration provided");
         }
+        /* integral of a function evaluated on a block of points at a
+           time; the points are the rows of the matrix passed to f.
+           Only available for quadratures, where the points are known
+           in advance. */
+        virtual Real integrateBlocks(
+            const std::function<void(const Matrix& points,
+                                     Array& values)>& f) const {
+            QL_FAIL("No block integration provided");
+        }
         virtual ~LMIntegration() = default;
     };
 
@@ -101,7 +111,10 @@ namespace QuantLib {
             #ifndef QL_PATCH_SOLARIS
             GaussianQuadrature,
             #endif
-            Trapezoid
+            Trapezoid,
+            #ifndef QL_PATCH_SOLARIS
+            SparseGridQuadrature
+            #endif
             // etc....
         } LatentModelIntegrationType;
     }
@@ -115,7 +128,8 @@ namespace QuantLib {
     public GaussianQuadMultidimIntegrator, public LMIntegration {
     public:
         IntegrationBase(Size dimension, Size order) 
-        : GaussianQuadMultidimIntegrator(dimension, order) {}
+        : GaussianQuadMultidimIntegrator(dimension, order),
+          grid_(dimension, order) {}
         Real integrate(const std::function<Real(const std::vector<Real>& arg)>& f) const override {
             return GaussianQuadMultidimIntegrator::integrate<Real>(f);
         }
@@ -124,6 +138,53 @@ namespace QuantLib {
             const override {
             return GaussianQuadMultidimIntegrator::integrate<std::vector<Real>>(f);
         }
+        Real integrateBlocks(
+            const std::function<void(const Matrix&, Array&)>& f) const override {
+            return grid_.integrate(f);
+        }
+        ~IntegrationBase() override = default;
+      private:
+        // the same nodes as the recursive quadrature, stored as a block
+        GaussianQuadMultidimGrid grid_;
+    };
+
+    /* Sparse grid quadrature; the pointwise integrands are evaluated
+    on the grid nodes in turn. */
+    template<> class IntegrationBase<GaussianQuadMultidimGrid> : 
+    public GaussianQuadMultidimGrid, public LMIntegration {
+    public:
+        IntegrationBase(Size dimension, Size level) 
+        : GaussianQuadMultidimGrid(dimension, level,
+                                   GaussianQuadMultidimGrid::SparseGrid) {}
+        Real integrate(const std::function<Real(const std::vector<Real>& arg)>& f) const override {
+            const Matrix& x = nodes();
+            std::vector<Real> point(dimension());
+            Real sum = 0.0;
+            for (Size i=0; i<size(); ++i) {
+                std::copy(x.row_begin(i), x.row_end(i), point.begin());
+                sum += weights()[i] * f(point);
+            }
+            return sum;
+        }
+        std::vector<Real> integrateV(
+            const std::function<std::vector<Real>(const std::vector<Real>& arg)>& f)
+            const override {
+            const Matrix& x = nodes();
+            std::vector<Real> point(dimension()), sum;
+            for (Size i=0; i<size(); ++i) {
+                std::copy(x.row_begin(i), x.row_end(i), point.begin());
+                std::vector<Real> term = f(point);
+                if (i == 0)
+                    sum.resize(term.size(), 0.0);
+                for (Size j=0; j<term.size(); ++j)
+                    sum[j] += weights()[i] * term[j];
+            }
+            return sum;
+        }
+        Real integrateBlocks(
+            const std::function<void(const Matrix&, Array&)>& f) const override {
+            return GaussianQuadMultidimGrid::integrate(f);
+        }
         ~IntegrationBase() override = default;
     };
 
@@ -343,6 +404,23 @@ namespace QuantLib {
                 // idiosyncratic term:
                 Real(allFactors[numFactors()+iVar] * idiosyncFctrs_[iVar]));
         }
+        /*! The values of all the latent variables conditional to a
+            set of values of the factors; equivalent to calling
+            latentVarValue for each variable, but with a single pass
+            over the factor weights.
+        */
+        void latentVarValues(const std::vector<Real>& allFactors,
+                             std::vector<Real>& values) const {
+            values.resize(nVariables_);
+            const Size nFactors = numFactors();
+            for (Size iVar=0; iVar<nVariables_; ++iVar) {
+                const Real* weights = &factorWeights_[iVar][0];
+                Real value = allFactors[nFactors+iVar] * idiosyncFctrs_[iVar];
+                for (Size k=0; k<nFactors; ++k)
+                    value += weights[k] * allFactors[k];
+                values[iVar] = value;
+            }
+        }
         // \to do write variants of the above, although is the most common case
 
         const copulaType& copula() const {
@@ -461,6 +539,15 @@ namespace QuantLib {
                             ext::make_shared<
                             IntegrationBase<GaussianQuadMultidimIntegrator> >(
                                 dimension, 25);
+                    case LatentModelIntegrationType::SparseGridQuadrature:
+                        /* finest rule with 15 points; the rules are not
+                        nested, so that the sparse grid only has fewer
+                        nodes than the tensor product above from three
+                        factors on. */
+                        return 
+                            ext::make_shared<
+                            IntegrationBase<GaussianQuadMultidimGrid> >(
+                                dimension, 8);
                     #endif
                     case LatentModelIntegrationType::Trapezoid:
                         {
@@ -596,6 +683,26 @@ namespace QuantLib {
             return integration()->integrateV(//see note in LMIntegrators base class
                 [&](const std::vector<Real>& x){ return M(copula_.density(x), f(x)); });
         }
+        /*! Integrates an arbitrary scalar function over the density
+            domain, evaluating it on blocks of points (the rows of the
+            matrix passed to f) instead of one point at a time.  The
+            blocks might be evaluated in parallel, so f must be
+            thread-safe; only quadrature integrations support it.
+        */
+        Real integratedExpectedValueBlocks(
+            const std::function<void(const Matrix& points,
+                                     Array& values)>& f) const {
+            return integration()->integrateBlocks(
+                [&](const Matrix& points, Array& values) {
+                    f(points, values);
+                    std::vector<Real> x(points.columns());
+                    for (Size i=0; i<points.rows(); ++i) {
+                        std::copy(points.row_begin(i), points.row_end(i),
+                                  x.begin());
+                        values[i] *= copula_.density(x);
+                    }
+                });
+        }
     protected:
         // Integrable models must provide their integrator.
         // Arguable, not having the integration in the LM class saves that 
@@ -21,6 +21,10 @@
 
 #ifndef QL_PATCH_SOLARIS
 
+#include <algorithm>
+#include <exception>
+#include <numeric>
+
 namespace QuantLib {
 
     GaussianQuadMultidimIntegrator::GaussianQuadMultidimIntegrator(
@@ -35,6 +39,137 @@ namespace QuantLib {
         spawnFcts<maxDimensions_>();
     }
 
+
+    namespace {
+
+        // adds the nodes of the tensor product of the given rules
+        void addTensorProduct(const std::vector<Array>& x,
+                              const std::vector<Array>& w,
+                              Real coefficient,
+                              std::vector<Real>& nodes,
+                              std::vector<Real>& weights) {
+            const Size dimension = x.size();
+            std::vector<Size> index(dimension, 0);
+            for (;;) {
+                Real weight = coefficient;
+                for (Size k=0; k<dimension; ++k) {
+                    nodes.push_back(x[k][index[k]]);
+                    weight *= w[k][index[k]];
+                }
+                weights.push_back(weight);
+
+                Size k = 0;
+                while (k < dimension && ++index[k] == x[k].size()) {
+                    index[k] = 0;
+                    ++k;
+                }
+                if (k == dimension)
+                    break;
+            }
+        }
+
+        Real binomial(Size n, Size k) {
+            Real result = 1.0;
+            for (Size i=1; i<=k; ++i)
+                result = result * Real(n - k + i) / Real(i);
+            return result;
+        }
+
+    }
+
+    GaussianQuadMultidimGrid::GaussianQuadMultidimGrid(Size dimension,
+                                                       Size order,
+                                                       Type type,
+                                                       Real mu) {
+        QL_REQUIRE(dimension > 0, "null dimension");
+        QL_REQUIRE(order > 0, "null quadrature order");
+
+        std::vector<Real> nodes, weights;
+        if (type == TensorProduct) {
+            GaussHermiteIntegration rule(order, mu);
+            std::vector<Array> x(dimension, rule.x()),
+                               w(dimension, rule.weights());
+            addTensorProduct(x, w, 1.0, nodes, weights);
+        } else {
+            // rules with 2l-1 points for levels l = 1...L
+            const Size level = order;
+            std::vector<Array> ruleX(level), ruleW(level);
+            for (Size l=0; l<level; ++l) {
+                GaussHermiteIntegration rule(2*l+1, mu);
+                ruleX[l] = rule.x();
+                ruleW[l] = rule.weights();
+            }
+            // combination technique: sum over the multi-indices
+            // (i_1...i_d), i_k >= 1, with L <= |i| <= L+d-1, of the
+            // tensor products weighted by (-1)^q binomial(d-1, q)
+            // where q = L+d-1-|i|
+            const Size maxSum = level + dimension - 1;
+            std::vector<Size> index(dimension);
+            std::vector<Array> x(dimension), w(dimension);
+            std::function<void(Size, Size)> addLevels =
+                [&](Size k, Size sum) {
+                if (k == dimension) {
+                    if (sum < level)
+                        return;
+                    const Size q = maxSum - sum;
+                    const Real coefficient =
+                        (q % 2 == 0 ? 1.0 : -1.0) * binomial(dimension-1, q);
+                    for (Size j=0; j<dimension; ++j) {
+                        x[j] = ruleX[index[j]-1];
+                        w[j] = ruleW[index[j]-1];
+                    }
+                    addTensorProduct(x, w, coefficient, nodes, weights);
+                    return;
+                }
+                const Size remaining = dimension - k - 1;
+                for (Size i=1; sum + i + remaining <= maxSum; ++i) {
+                    index[k] = i;
+                    addLevels(k + 1, sum + i);
+                }
+            };
+            addLevels(0, 0);
+        }
+
+        nodes_ = Matrix(weights.size(), dimension);
+        std::copy(nodes.begin(), nodes.end(), nodes_.begin());
+        weights_ = Array(weights.begin(), weights.end());
+    }
+
+    Real GaussianQuadMultidimGrid::integrate(const BlockFunction& f,
+                                             Size blockSize) const {
+        QL_REQUIRE(blockSize > 0, "positive block size required");
+        const Size n = size(), dimension = this->dimension();
+        const Size blocks = (n + blockSize - 1) / blockSize;
+
+        // the values are stored so that they are added in a fixed order
+        std::vector<Real> values(n);
+        std::exception_ptr error;
+        #pragma omp parallel for if(blocks > 1)
+        for (long b=0; b<long(blocks); ++b) {
+            try {
+                const Size first = b*blockSize;
+                const Size last = std::min(first + blockSize, n);
+                Matrix points(last - first, dimension);
+                std::copy(nodes_.begin() + first*dimension,
+                          nodes_.begin() + last*dimension,
+                          points.begin());
+                Array blockValues(last - first);
+                f(points, blockValues);
+                std::copy(blockValues.begin(), blockValues.end(),
+                          values.begin() + first);
+            } catch (...) {
+                #pragma omp critical
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception(error);
+
+        return std::inner_product(weights_.begin(), weights_.end(),
+                                  values.begin(), Real(0.0));
+    }
+
 }
 
 #endif
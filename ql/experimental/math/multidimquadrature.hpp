@@ -30,6 +30,7 @@
 #ifndef QL_PATCH_SOLARIS
 
 #include <ql/math/integrals/gaussianquadratures.hpp>
+#include <ql/math/matrix.hpp>
 #include <functional>
 
 namespace QuantLib {
@@ -85,6 +86,8 @@ namespace QuantLib {
             Real mu = 0.);
         //! Integration quadrature order.
         Size order() const {return integralV_.order();}
+        //! Dimension of the integration domain.
+        Size dimension() const {return dimension_;}
 
         //! Integrates function f over \f$ R^{dim} \f$
         /* This function is just syntax since the only thing it does is calling 
@@ -183,6 +186,50 @@ namespace QuantLib {
     };
 
 
+    //! Nodes and weights of a multidimensional Gauss-Hermite quadrature
+    /*! The nodes are stored as the rows of a matrix, so that the
+        integrand can be evaluated on a block of points at a time
+        instead of one point per call.  The blocks are evaluated in
+        parallel when QuantLib is compiled with OpenMP support; in
+        that case, the integrand must be thread-safe.
+
+        Besides the full tensor product of one-dimensional rules, the
+        nodes can form a Smolyak sparse grid, built by the combination
+        technique from rules with 1, 3, 5... points; the level \f$ L
+        \f$ of the grid corresponds to a finest rule of \f$ 2L-1 \f$
+        points.  For smooth integrands, this needs far fewer nodes
+        than the tensor product as the dimension grows.  Some of the
+        sparse-grid weights are negative.
+    */
+    class GaussianQuadMultidimGrid {
+      public:
+        enum Type { TensorProduct, SparseGrid };
+        //! fills the values of the integrand at the given points (rows)
+        typedef std::function<void(const Matrix& points, Array& values)>
+            BlockFunction;
+        /*!
+            @param dimension The number of dimensions of the domain.
+            @param order Quadrature order for the tensor product;
+                   level for the sparse grid.
+            @param type Grid type.
+            @param mu Parameter in the Gauss Hermite weight.
+        */
+        GaussianQuadMultidimGrid(Size dimension,
+                                 Size order,
+                                 Type type = TensorProduct,
+                                 Real mu = 0.0);
+        Size dimension() const { return nodes_.columns(); }
+        Size size() const { return nodes_.rows(); }
+        const Matrix& nodes() const { return nodes_; }
+        const Array& weights() const { return weights_; }
+        //! Integrates function f over \f$ R^{dim} \f$
+        Real integrate(const BlockFunction& f, Size blockSize = 256) const;
+      private:
+        Matrix nodes_;
+        Array weights_;
+    };
+
+
     // Template specializations ---------------------------------------------
 
     template<>
@@ -1,4 +1,7 @@
 /* This file is automatically generated; do not edit.     */
 /* Add the files to be included into Makefile.am instead. */
 
+#include <ql/experimental/risk/bucketedsensitivityengine.hpp>
+#include <ql/experimental/risk/portfoliomarket.hpp>
+#include <ql/experimental/risk/scenarioengine.hpp>
 
@@ -0,0 +1,133 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/experimental/risk/bucketedsensitivityengine.hpp>
+#include <ql/utilities/null.hpp>
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace QuantLib {
+
+    namespace {
+
+        typedef std::chrono::steady_clock clock_type;
+
+        Real secondsSince(const clock_type::time_point& start) {
+            return std::chrono::duration<Real>(clock_type::now() - start).count();
+        }
+
+        std::vector<Real> portfolioValues(
+                 const std::vector<ext::shared_ptr<Instrument> >& instruments) {
+            std::vector<Real> values(instruments.size());
+            for (Size i=0; i<instruments.size(); ++i)
+                values[i] = instruments[i]->NPV();
+            return values;
+        }
+
+    }
+
+    BucketedSensitivityEngine::BucketedSensitivityEngine(MarketFactory factory,
+                                                         Real shift,
+                                                         Type type,
+                                                         Size numberOfMarkets)
+    : factory_(std::move(factory)), shift_(shift), type_(type),
+      numberOfMarkets_(numberOfMarkets) {
+        QL_REQUIRE(shift_ != 0.0, "null shift not allowed");
+        QL_REQUIRE(numberOfMarkets_ > 0, "at least one market required");
+    }
+
+    BucketedSensitivityEngine::Results
+    BucketedSensitivityEngine::calculate() const {
+        const auto start = clock_type::now();
+
+        const Size n = numberOfMarkets_;
+        const std::vector<Market> markets = detail::buildPortfolioMarkets(factory_, n);
+        const Size quotes = markets[0].quotes.size();
+        const Size instruments = markets[0].instruments.size();
+        QL_REQUIRE(quotes > 0, "no quotes given");
+
+        Results results;
+        results.delta = Matrix(instruments, quotes);
+        results.gamma = Matrix(instruments, quotes, Null<Real>());
+        results.bumpTimes.resize(quotes);
+
+        const Size quotesPerMarket = (quotes + n - 1) / n;
+        detail::forEachPortfolioMarket(n, [&](Size k) {
+            const Market& market = markets[k];
+            const std::vector<Real> base = portfolioValues(market.instruments);
+            if (k == 0)
+                results.values = base;
+
+            const Size first = std::min(k*quotesPerMarket, quotes);
+            const Size last = std::min(first + quotesPerMarket, quotes);
+            for (Size j=first; j<last; ++j) {
+                const auto bumpStart = clock_type::now();
+                const ext::shared_ptr<SimpleQuote>& quote = market.quotes[j];
+                const Real value = quote->value();
+
+                quote->setValue(value + shift_);
+                const std::vector<Real> up = portfolioValues(market.instruments);
+                if (type_ == Centered) {
+                    quote->setValue(value - shift_);
+                    const std::vector<Real> down = portfolioValues(market.instruments);
+                    for (Size i=0; i<instruments; ++i) {
+                        results.delta[i][j] = (up[i] - down[i]) / (2.0 * shift_);
+                        results.gamma[i][j] =
+                            (up[i] - 2.0 * base[i] + down[i]) / (shift_ * shift_);
+                    }
+                } else {
+                    for (Size i=0; i<instruments; ++i)
+                        results.delta[i][j] = (up[i] - base[i]) / shift_;
+                }
+                quote->setValue(value);
+
+                results.bumpTimes[j] = secondsSince(bumpStart);
+            }
+        });
+
+        // parallel bump on the first copy of the market
+        const Market& market = markets[0];
+        std::vector<Real> values(quotes);
+        for (Size j=0; j<quotes; ++j) {
+            values[j] = market.quotes[j]->value();
+            market.quotes[j]->setValue(values[j] + shift_);
+        }
+        const std::vector<Real> up = portfolioValues(market.instruments);
+        results.parallelDelta.resize(instruments);
+        results.parallelGamma.assign(instruments, Null<Real>());
+        if (type_ == Centered) {
+            for (Size j=0; j<quotes; ++j)
+                market.quotes[j]->setValue(values[j] - shift_);
+            const std::vector<Real> down = portfolioValues(market.instruments);
+            for (Size i=0; i<instruments; ++i) {
+                results.parallelDelta[i] = (up[i] - down[i]) / (2.0 * shift_);
+                results.parallelGamma[i] =
+                    (up[i] - 2.0 * results.values[i] + down[i]) / (shift_ * shift_);
+            }
+        } else {
+            for (Size i=0; i<instruments; ++i)
+                results.parallelDelta[i] = (up[i] - results.values[i]) / shift_;
+        }
+        for (Size j=0; j<quotes; ++j)
+            market.quotes[j]->setValue(values[j]);
+
+        results.elapsedTime = secondsSince(start);
+        return results;
+    }
+
+}
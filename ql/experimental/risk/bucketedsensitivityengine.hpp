@@ -0,0 +1,88 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file bucketedsensitivityengine.hpp
+    \brief bucketed and parallel sensitivities of a portfolio to market quotes
+*/
+
+#ifndef quantlib_bucketed_sensitivity_engine_hpp
+#define quantlib_bucketed_sensitivity_engine_hpp
+
+#include <ql/experimental/risk/portfoliomarket.hpp>
+#include <ql/math/matrix.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Bucketed and parallel sensitivities of a portfolio to market quotes
+    /*! Each quote is bumped in turn and the portfolio is revalued;
+        the resulting deltas and gammas are returned as a ladder for
+        each instrument.  The quotes are then bumped together to
+        obtain parallel sensitivities.
+
+        The quotes are split into contiguous blocks which are
+        processed in parallel when QuantLib is compiled with OpenMP
+        support; each block works on its own copy of the market and
+        of the portfolio, built by the given factory (see the
+        PortfolioMarket class.)  The factory is only called from the
+        calling thread.
+
+        Each quote is restored after being bumped, and each copy of
+        the market is left in place between bumps; therefore, piecewise
+        curves depending on the quotes re-bootstrap starting from the
+        base solution, and the pillars not affected by the bump
+        converge at the first iteration.
+
+        \ingroup engines
+    */
+    class BucketedSensitivityEngine {
+      public:
+        enum Type { OneSided, Centered };
+        typedef PortfolioMarket Market;
+        typedef PortfolioMarketFactory MarketFactory;
+        struct Results {
+            //! base values of the instruments
+            std::vector<Real> values;
+            /*! sensitivities of each instrument (rows) to each
+                quote (columns); gammas are null for one-sided bumps
+            */
+            Matrix delta, gamma;
+            //! sensitivities of each instrument to a parallel bump
+            std::vector<Real> parallelDelta, parallelGamma;
+            //! time in seconds spent revaluing the portfolio for each quote
+            std::vector<Real> bumpTimes;
+            //! total time in seconds, including the market construction
+            Real elapsedTime;
+        };
+
+        BucketedSensitivityEngine(MarketFactory factory,
+                                  Real shift = 0.0001,
+                                  Type type = Centered,
+                                  Size numberOfMarkets = 1);
+
+        Results calculate() const;
+
+      private:
+        MarketFactory factory_;
+        Real shift_;
+        Type type_;
+        Size numberOfMarkets_;
+    };
+
+}
+
+#endif
@@ -0,0 +1,89 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file portfoliomarket.hpp
+    \brief copies of market quotes and portfolio for parallel revaluation
+*/
+
+#ifndef quantlib_portfolio_market_hpp
+#define quantlib_portfolio_market_hpp
+
+#include <ql/instrument.hpp>
+#include <ql/quotes/simplequote.hpp>
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace QuantLib {
+
+    //! a copy of the market quotes and of a portfolio depending on them
+    /*! Since QuantLib objects cannot be shared between threads,
+        engines revaluing a portfolio in parallel work on several
+        copies of the market, each built by a factory; the copies
+        must not share any observable (apart from the global
+        settings, which are not modified.)
+    */
+    struct PortfolioMarket {
+        std::vector<ext::shared_ptr<SimpleQuote> > quotes;
+        std::vector<ext::shared_ptr<Instrument> > instruments;
+    };
+
+    typedef std::function<PortfolioMarket()> PortfolioMarketFactory;
+
+    namespace detail {
+
+        //! builds the given number of market copies from the calling thread
+        inline std::vector<PortfolioMarket>
+        buildPortfolioMarkets(const PortfolioMarketFactory& factory,
+                              Size numberOfMarkets) {
+            std::vector<PortfolioMarket> markets(numberOfMarkets);
+            for (Size k=0; k<numberOfMarkets; ++k) {
+                markets[k] = factory();
+                QL_REQUIRE(markets[k].quotes.size() == markets[0].quotes.size() &&
+                           markets[k].instruments.size() == markets[0].instruments.size(),
+                           "the market copies must have the same number of "
+                           "quotes and instruments");
+            }
+            return markets;
+        }
+
+        /*! calls f(k) for each market copy, in parallel when QuantLib
+            is compiled with OpenMP support; the first exception
+            thrown, if any, is rethrown from the calling thread.
+        */
+        template <class F>
+        void forEachPortfolioMarket(Size numberOfMarkets, const F& f) {
+            std::exception_ptr error;
+            #pragma omp parallel for if(numberOfMarkets > 1)
+            for (long k=0; k<long(numberOfMarkets); ++k) {
+                try {
+                    f(Size(k));
+                } catch (...) {
+                    #pragma omp critical
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+    }
+
+}
+
+#endif
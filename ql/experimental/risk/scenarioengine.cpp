@@ -0,0 +1,114 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/experimental/risk/scenarioengine.hpp>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace QuantLib {
+
+    ScenarioEngine::ScenarioEngine(MarketFactory factory,
+                                   ShiftType shiftType,
+                                   Size numberOfMarkets,
+                                   Size batchSize)
+    : factory_(std::move(factory)), shiftType_(shiftType),
+      numberOfMarkets_(numberOfMarkets), batchSize_(batchSize) {
+        QL_REQUIRE(numberOfMarkets_ > 0, "at least one market required");
+        QL_REQUIRE(batchSize_ > 0, "positive batch size required");
+    }
+
+    std::vector<Real> ScenarioEngine::calculate(const Real* scenarios,
+                                                Size numberOfScenarios,
+                                                Size numberOfQuotes,
+                                                const ResultHandler& handler) const {
+        const Size n = numberOfMarkets_;
+        const std::vector<Market> markets = detail::buildPortfolioMarkets(factory_, n);
+        const Size quotes = markets[0].quotes.size();
+        const Size instruments = markets[0].instruments.size();
+        QL_REQUIRE(numberOfQuotes == quotes,
+                   "wrong number of shifts (" << numberOfQuotes << ") for "
+                   << quotes << " quotes");
+
+        std::vector<Real> baseQuotes(quotes), baseValues(instruments);
+        for (Size j=0; j<quotes; ++j)
+            baseQuotes[j] = markets[0].quotes[j]->value();
+        for (Size i=0; i<instruments; ++i)
+            baseValues[i] = markets[0].instruments[i]->NPV();
+
+        const Size batchSize = std::min(batchSize_, numberOfScenarios);
+        std::vector<std::vector<Real> > values(batchSize,
+                                               std::vector<Real>(instruments));
+
+        for (Size start=0; start<numberOfScenarios; start+=batchSize) {
+            const Size scenariosInBatch =
+                std::min(batchSize, numberOfScenarios - start);
+            const Size scenariosPerMarket = (scenariosInBatch + n - 1) / n;
+
+            detail::forEachPortfolioMarket(n, [&](Size k) {
+                const Market& market = markets[k];
+                const Size first = std::min(k*scenariosPerMarket, scenariosInBatch);
+                const Size last = std::min(first + scenariosPerMarket, scenariosInBatch);
+                for (Size s=first; s<last; ++s) {
+                    const Real* shifts = scenarios + (start + s) * quotes;
+                    for (Size j=0; j<quotes; ++j) {
+                        const Real value = shiftType_ == Absolute
+                                               ? baseQuotes[j] + shifts[j]
+                                               : baseQuotes[j] * (1.0 + shifts[j]);
+                        market.quotes[j]->setValue(value);
+                    }
+                    for (Size i=0; i<instruments; ++i)
+                        values[s][i] = market.instruments[i]->NPV();
+                }
+            });
+
+            for (Size s=0; s<scenariosInBatch; ++s)
+                handler(start + s, values[s]);
+        }
+
+        return baseValues;
+    }
+
+    std::vector<Real> ScenarioEngine::calculate(const Matrix& scenarios,
+                                                const ResultHandler& handler) const {
+        return calculate(scenarios.begin(), scenarios.rows(), scenarios.columns(),
+                         handler);
+    }
+
+    RiskStatistics ScenarioEngine::profitAndLoss(const Real* scenarios,
+                                                 Size numberOfScenarios,
+                                                 Size numberOfQuotes) const {
+        std::vector<Real> pnl(numberOfScenarios);
+        const std::vector<Real> baseValues = calculate(
+            scenarios, numberOfScenarios, numberOfQuotes,
+            [&](Size scenario, const std::vector<Real>& values) {
+                pnl[scenario] = std::accumulate(values.begin(), values.end(), Real(0.0));
+            });
+        const Real baseValue =
+            std::accumulate(baseValues.begin(), baseValues.end(), Real(0.0));
+
+        RiskStatistics stats;
+        for (Size s=0; s<numberOfScenarios; ++s)
+            stats.add(pnl[s] - baseValue);
+        return stats;
+    }
+
+    RiskStatistics ScenarioEngine::profitAndLoss(const Matrix& scenarios) const {
+        return profitAndLoss(scenarios.begin(), scenarios.rows(), scenarios.columns());
+    }
+
+}
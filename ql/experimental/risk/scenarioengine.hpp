@@ -0,0 +1,95 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file scenarioengine.hpp
+    \brief full revaluation of a portfolio under market scenarios
+*/
+
+#ifndef quantlib_scenario_engine_hpp
+#define quantlib_scenario_engine_hpp
+
+#include <ql/experimental/risk/portfoliomarket.hpp>
+#include <ql/math/matrix.hpp>
+#include <ql/math/statistics/riskstatistics.hpp>
+#include <functional>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Full revaluation of a portfolio under market scenarios
+    /*! Each scenario gives a shift for each of the market quotes;
+        the shifts are applied to the base quote values and the
+        portfolio is revalued.  The scenarios are read as a row-major
+        array of size (number of scenarios) \f$ \times \f$ (number of
+        quotes); they can be passed as a Matrix or as a pointer to
+        externally managed memory, e.g., a memory-mapped file.  The
+        number of quotes must match the size of the market copies.
+
+        The scenarios are processed in batches.  The scenarios in a
+        batch are split into contiguous blocks which are processed in
+        parallel when QuantLib is compiled with OpenMP support; each
+        block works on its own copy of the market and of the
+        portfolio, built by the given factory (see the
+        PortfolioMarket class.)  The results of each batch are passed to the
+        handler in scenario order and from the calling thread.
+
+        When a scenario is applied, only the first quote change
+        causes a notification to be propagated through the curves and
+        instruments; lazy objects forward only the first notification
+        they receive until they are recalculated (unless
+        QL_FASTER_LAZY_OBJECTS is disabled.)
+
+        \ingroup engines
+    */
+    class ScenarioEngine {
+      public:
+        enum ShiftType { Absolute, Relative };
+        typedef PortfolioMarket Market;
+        typedef PortfolioMarketFactory MarketFactory;
+        //! receives the index of a scenario and the instrument values
+        typedef std::function<void(Size, const std::vector<Real>&)> ResultHandler;
+
+        ScenarioEngine(MarketFactory factory,
+                       ShiftType shiftType = Absolute,
+                       Size numberOfMarkets = 1,
+                       Size batchSize = 256);
+
+        /*! revalues the portfolio under each scenario and returns
+            the base values of the instruments.
+        */
+        std::vector<Real> calculate(const Real* scenarios,
+                                    Size numberOfScenarios,
+                                    Size numberOfQuotes,
+                                    const ResultHandler& handler) const;
+        std::vector<Real> calculate(const Matrix& scenarios,
+                                    const ResultHandler& handler) const;
+
+        //! distribution of the profit and loss of the whole portfolio
+        RiskStatistics profitAndLoss(const Real* scenarios,
+                                     Size numberOfScenarios,
+                                     Size numberOfQuotes) const;
+        RiskStatistics profitAndLoss(const Matrix& scenarios) const;
+
+      private:
+        MarketFactory factory_;
+        ShiftType shiftType_;
+        Size numberOfMarkets_, batchSize_;
+    };
+
+}
+
+#endif
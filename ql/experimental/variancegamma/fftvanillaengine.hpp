@@ -24,7 +24,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #ifndef quantlib_fft_vanilla_engine_hpp
 #define quantlib_fft_vanilla_engine_hpp
 
-#include <ql/experimental/variancegamma/fftengine.hpp>
+#include <ql/pricingengines/vanilla/fftengine.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
 #include <complex>
 
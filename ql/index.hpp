@@ -115,10 +115,21 @@ namespace QuantLib {
             return IndexManager::instance().notifier(name());
             QL_DEPRECATED_ENABLE_WARNING
         }
+        /*! resolves the handle of the fixing history in the
+            IndexManager; derived classes call it in their
+            constructors once the name is available, so that past
+            fixings are then retrieved without any name lookup.
+        */
+        void resolveHistoryHandle() {
+            historyHandle_ = IndexManager::instance().handle(name());
+        }
 
       private:
         //! check if index allows for native fixings
         void checkNativeFixingsAllowed();
+        //! the handle of the fixing history in the IndexManager
+        Size historyHandle() const;
+        Size historyHandle_ = Null<Size>();
 
     };
 
@@ -130,7 +141,18 @@ namespace QuantLib {
 
     inline Real Index::pastFixing(const Date& fixingDate) const {
         QL_REQUIRE(isValidFixingDate(fixingDate), fixingDate << " is not a valid fixing date");
-        return timeSeries()[fixingDate];
+        return IndexManager::instance().pastFixing(historyHandle(), fixingDate);
+    }
+
+    inline Size Index::historyHandle() const {
+        #ifndef QL_ENABLE_SESSIONS
+        // names don't change, so the handle resolved on construction
+        // is used; each session has its own IndexManager otherwise
+        if (historyHandle_ != Null<Size>())
+            return historyHandle_;
+        #endif
+        // an unknown name has no history and is not added
+        return IndexManager::instance().find(name());
     }
 
     inline void Index::update() {
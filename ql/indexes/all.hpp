@@ -7,6 +7,7 @@
 #include <ql/indexes/indexmanager.hpp>
 #include <ql/indexes/inflationindex.hpp>
 #include <ql/indexes/interestrateindex.hpp>
+#include <ql/indexes/overnightfixingaccumulator.hpp>
 #include <ql/indexes/region.hpp>
 #include <ql/indexes/swapindex.hpp>
 
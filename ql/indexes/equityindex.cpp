@@ -46,6 +46,7 @@ namespace QuantLib {
         registerWith(spot_);
         registerWith(Settings::instance().evaluationDate());
         registerWith(notifier());
+        resolveHistoryHandle();
     }
 
     Real EquityIndex::fixing(const Date& fixingDate, bool forecastTodaysFixing) const {
@@ -20,6 +20,7 @@
 */
 
 #include <ql/indexes/iborindex.hpp>
+#include <ql/indexes/overnightfixingaccumulator.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <utility>
 
@@ -80,7 +81,9 @@ namespace QuantLib {
                                    const DayCounter& dc,
                                    const Handle<YieldTermStructure>& h)
    : IborIndex(familyName, 1*Days, settlementDays, curr,
-               fixCal, Following, false, dc, h) {}
+               fixCal, Following, false, dc, h),
+     fixingAccumulator_(ext::make_shared<OvernightFixingAccumulator>(
+         name(), fixingCalendar(), dayCounter(), fixingDays())) {}
 
     ext::shared_ptr<IborIndex> OvernightIndex::clone(
                                const Handle<YieldTermStructure>& h) const {
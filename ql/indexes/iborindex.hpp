@@ -31,6 +31,8 @@
 
 namespace QuantLib {
 
+    class OvernightFixingAccumulator;
+
     //! base class for Inter-Bank-Offered-Rate indexes (e.g. %Libor, etc.)
     class IborIndex : public InterestRateIndex {
       public:
@@ -95,6 +97,14 @@ namespace QuantLib {
                        const Handle<YieldTermStructure>& h = {});
         //! returns a copy of itself linked to a different forwarding curve
         ext::shared_ptr<IborIndex> clone(const Handle<YieldTermStructure>& h) const override;
+        /*! returns the cumulative compounding factors of the past
+            fixings; they're updated whenever the stored fixings change.
+        */
+        const OvernightFixingAccumulator& fixingAccumulator() const {
+            return *fixingAccumulator_;
+        }
+      private:
+        ext::shared_ptr<OvernightFixingAccumulator> fixingAccumulator_;
     };
 
 
@@ -18,20 +18,55 @@
 */
 
 #include <ql/indexes/indexmanager.hpp>
+#include <ql/utilities/dataparsers.hpp>
+#include <cctype>
+#include <locale>
+#include <sstream>
+#include <string>
 
 namespace QuantLib {
 
+    namespace {
+
+        std::string trimmed(const std::string& s, std::size_t begin, std::size_t end) {
+            while (begin < end && std::isspace(static_cast<unsigned char>(s[begin])))
+                ++begin;
+            while (end > begin && std::isspace(static_cast<unsigned char>(s[end-1])))
+                --end;
+            return s.substr(begin, end - begin);
+        }
+
+        Real parseFixing(const std::string& s) {
+            // unlike std::stod, this doesn't depend on the global locale
+            std::istringstream in(s);
+            in.imbue(std::locale::classic());
+            Real value;
+            in >> value;
+            QL_REQUIRE(!in.fail() && (in >> std::ws).eof(), "invalid fixing: " << s);
+            return value;
+        }
+
+    }
+
     bool IndexManager::hasHistory(const std::string& name) const {
-        return data_.find(name) != data_.end();
+        const Size i = find(name);
+        return i != Null<Size>() && data_[i].stored;
     }
 
     const TimeSeries<Real>& IndexManager::getHistory(const std::string& name) const {
-        return data_[name];
+        static const TimeSeries<Real> noHistory;
+        const Size i = find(name);
+        return i != Null<Size>() ? data_[i].fixings : noHistory;
     }
 
     void IndexManager::setHistory(const std::string& name, TimeSeries<Real> history) {
+        History& h = data_[handle(name)];
+        h.fixings = std::move(history);
+        rebuildDense(h);
+        h.stored = true;
+        // observers are notified once the history is modified, so
+        // that they can read it right away
         notifier(name)->notifyObservers();
-        data_[name] = std::move(history);
     }
 
     void IndexManager::addFixing(const std::string& name,
@@ -41,6 +76,78 @@ namespace QuantLib {
         addFixings(name, &fixingDate, (&fixingDate) + 1, &fixing, forceOverwrite);
     }
 
+    void IndexManager::loadFixings(std::istream& in, bool forceOverwrite) {
+        std::vector<std::string> names;
+        std::vector<std::vector<Date> > dates;
+        std::vector<std::vector<Real> > values;
+        // the position of each history in the above vectors
+        std::vector<Size> positions(data_.size(), Null<Size>());
+
+        std::string line, name;
+        Size current = Null<Size>();
+        Size lineNumber = 0;
+        while (std::getline(in, line)) {
+            ++lineNumber;
+            if (line.find_first_not_of(" \t\r") == std::string::npos)
+                continue;
+            const std::size_t first = line.find(',');
+            const std::size_t second =
+                first == std::string::npos ? first : line.find(',', first + 1);
+            QL_REQUIRE(second != std::string::npos,
+                       "wrong format at line " << lineNumber << ": " << line);
+            // consecutive lines usually refer to the same index
+            const std::string lineName = trimmed(line, 0, first);
+            if (current == Null<Size>() || lineName != name) {
+                name = lineName;
+                const Size h = handle(name);
+                if (h >= positions.size())
+                    positions.resize(h + 1, Null<Size>());
+                if (positions[h] == Null<Size>()) {
+                    positions[h] = names.size();
+                    names.push_back(name);
+                    dates.emplace_back();
+                    values.emplace_back();
+                }
+                current = positions[h];
+            }
+            try {
+                const std::string date = trimmed(line, first + 1, second);
+                const std::string value = trimmed(line, second + 1, line.size());
+                dates[current].push_back(DateParser::parseISO(date));
+                values[current].push_back(parseFixing(value));
+            } catch (std::exception& e) {
+                QL_FAIL("wrong format at line " << lineNumber << ": " << line
+                        << " (" << e.what() << ")");
+            }
+        }
+
+        for (Size i=0; i<names.size(); ++i)
+            addFixings(names[i], dates[i].begin(), dates[i].end(), values[i].begin(),
+                       forceOverwrite);
+    }
+
+    void IndexManager::rebuildDense(History& h) {
+        h.dense.clear();
+        if (!h.fixings.empty()) {
+            h.denseStart = h.fixings.firstDate().serialNumber();
+            h.dense.resize(h.fixings.lastDate().serialNumber() - h.denseStart + 1,
+                           Null<Real>());
+            for (const auto& f : h.fixings)
+                h.dense[f.first.serialNumber() - h.denseStart] = f.second;
+        }
+        h.denseUpToDate = true;
+    }
+
+    Real IndexManager::pastFixing(Size handle, const Date& fixingDate) const {
+        if (handle == Null<Size>())
+            return Null<Real>();
+        const History& h = data_[handle];
+        const Date::serial_type k = fixingDate.serialNumber() - h.denseStart;
+        if (k < 0 || k >= static_cast<Date::serial_type>(h.dense.size()))
+            return Null<Real>();
+        return h.dense[k];
+    }
+
     ext::shared_ptr<Observable> IndexManager::notifier(const std::string& name) const {
         auto n = notifiers_.find(name);
         if(n != notifiers_.end())
@@ -52,27 +159,33 @@ namespace QuantLib {
 
     std::vector<std::string> IndexManager::histories() const {
         std::vector<std::string> temp;
-        temp.reserve(data_.size());
-        for (const auto& i : data_)
-            temp.push_back(i.first);
+        for (const auto& i : handles_) {
+            if (data_[i.second].stored)
+                temp.push_back(i.first);
+        }
         return temp;
     }
 
     void IndexManager::clearHistory(const std::string& name) {
+        auto i = handles_.find(name);
+        if (i != handles_.end())
+            data_[i->second] = History();
         notifier(name)->notifyObservers();
-        data_.erase(name);
     }
 
     void IndexManager::clearHistories() {
-        for (auto const& d : data_)
-            notifier(d.first)->notifyObservers();
-        data_.clear();
+        for (auto const& i : handles_) {
+            const bool stored = data_[i.second].stored;
+            data_[i.second] = History();
+            if (stored)
+                notifier(i.first)->notifyObservers();
+        }
     }
 
     bool IndexManager::hasHistoricalFixing(const std::string& name, const Date& fixingDate) const {
-        auto const& indexIter = data_.find(name);
-        return (indexIter != data_.end()) &&
-               ((*indexIter).second[fixingDate] != Null<Real>());
+        const Size i = find(name);
+        return i != Null<Size>() && data_[i].stored &&
+               pastFixing(i, fixingDate) != Null<Real>();
     }
 
 }
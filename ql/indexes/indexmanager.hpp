@@ -30,14 +30,24 @@
 #include <ql/utilities/observablevalue.hpp>
 #include <algorithm>
 #include <cctype>
+#include <deque>
+#include <istream>
 
 namespace QuantLib {
 
     //! global repository for past index fixings
-    /*! \note index names are case insensitive */
+    /*! Each index name is resolved once to an integer handle, which
+        indexes can store to avoid further lookups.  Besides the time
+        series returned to clients, the fixings of each index are
+        kept in a contiguous array indexed by date serial number;
+        past fixings are retrieved from the latter in constant time.
+
+        \note index names are case insensitive
+    */
     class IndexManager : public Singleton<IndexManager> {
         friend class Singleton<IndexManager>;
         friend class Index;
+        friend class OvernightFixingAccumulator;
 
       private:
         IndexManager() = default;
@@ -47,6 +57,18 @@ namespace QuantLib {
         std::vector<std::string> histories() const;
         //! clears all stored fixings
         void clearHistories();
+        //! loads fixings from a stream
+        /*! Each line of the stream must contain the name of an
+            index, a date in ISO format (yyyy-mm-dd) and a fixing,
+            separated by commas; blank lines are skipped.  The
+            stream is read in a single pass and the fixings for each
+            index are stored at once, so that the observers of each
+            index are notified only once.
+
+            \warning fixing dates are not validated against the
+                     calendars of the indexes.
+        */
+        void loadFixings(std::istream& in, bool forceOverwrite = false);
 
       private:
         struct CaseInsensitiveCompare {
@@ -57,9 +79,35 @@ namespace QuantLib {
           }
         };
 
-        mutable std::map<std::string, TimeSeries<Real>, CaseInsensitiveCompare> data_;
+        struct History {
+            TimeSeries<Real> fixings;
+            // the fixings indexed by date serial number, starting at
+            // denseStart; they're kept in sync by each update, so that
+            // reading them doesn't modify the history
+            std::vector<Real> dense;
+            Date::serial_type denseStart = 0;
+            bool denseUpToDate = true;
+            // whether the history was stored since the last clear
+            bool stored = false;
+        };
+
+        std::map<std::string, Size, CaseInsensitiveCompare> handles_;
+        std::deque<History> data_;
         mutable std::map<std::string, ext::shared_ptr<Observable>> notifiers_;
 
+        //! returns the handle of the history for the given name, creating it if needed
+        Size handle(const std::string& name);
+        //! returns the handle of the history for the given name, or Null<Size>() if there's none
+        Size find(const std::string& name) const;
+        /*! returns the stored fixing, or Null<Real>() if it's missing
+            or if the handle is Null<Size>()
+        */
+        Real pastFixing(Size handle, const Date& fixingDate) const;
+        //! stores a fixing, keeping the contiguous copy in sync when possible
+        static void storeFixing(History& h, const Date& fixingDate, Real fixing);
+        //! rebuilds the contiguous copy of the fixings
+        static void rebuildDense(History& h);
+
         //! add a fixing
         void addFixing(const std::string& name,
                        const Date& fixingDate,
@@ -73,7 +121,9 @@ namespace QuantLib {
                         ValueIterator vBegin,
                         bool forceOverwrite = false,
                         const std::function<bool(const Date& d)>& isValidFixingDate = {}) {
-            auto& h = data_[name];
+            History& history = data_[handle(name)];
+            history.stored = true;
+            auto& h = history.fixings;
             bool noInvalidFixing = true, noDuplicatedFixing = true;
             Date invalidDate, duplicatedDate;
             Real nullValue = Null<Real>();
@@ -85,7 +135,7 @@ namespace QuantLib {
                 bool missingFixing = forceOverwrite || currentValue == nullValue;
                 if (validFixing) {
                     if (missingFixing)
-                        h[*(dBegin++)] = *(vBegin++);
+                        storeFixing(history, *(dBegin++), *(vBegin++));
                     else if (close(currentValue, *(vBegin))) {
                         ++dBegin;
                         ++vBegin;
@@ -100,6 +150,8 @@ namespace QuantLib {
                     invalidValue = *(vBegin++);
                 }
             }
+            if (!history.denseUpToDate)
+                rebuildDense(history);
             QL_DEPRECATED_DISABLE_WARNING
             notifier(name)->notifyObservers();
             QL_DEPRECATED_ENABLE_WARNING
@@ -120,6 +172,40 @@ namespace QuantLib {
         ext::shared_ptr<Observable> notifier(const std::string& name) const;
     };
 
+
+    // inline definitions
+
+    inline Size IndexManager::handle(const std::string& name) {
+        auto i = handles_.find(name);
+        if (i != handles_.end())
+            return i->second;
+        data_.emplace_back();
+        return handles_[name] = data_.size() - 1;
+    }
+
+    inline Size IndexManager::find(const std::string& name) const {
+        auto i = handles_.find(name);
+        return i != handles_.end() ? i->second : Null<Size>();
+    }
+
+    inline void IndexManager::storeFixing(History& h, const Date& fixingDate, Real fixing) {
+        h.fixings[fixingDate] = fixing;
+        if (!h.denseUpToDate)
+            return;
+        const Date::serial_type serial = fixingDate.serialNumber();
+        if (h.dense.empty()) {
+            h.dense.assign(1, fixing);
+            h.denseStart = serial;
+        } else if (serial < h.denseStart) {
+            h.denseUpToDate = false;
+        } else {
+            const auto k = static_cast<Size>(serial - h.denseStart);
+            if (k >= h.dense.size())
+                h.dense.resize(k + 1, Null<Real>());
+            h.dense[k] = fixing;
+        }
+    }
+
 }
 
 
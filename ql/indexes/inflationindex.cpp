@@ -131,6 +131,7 @@ namespace QuantLib {
         name_ = region_.name() + " " + familyName_;
         registerWith(Settings::instance().evaluationDate());
         registerWith(notifier());
+        resolveHistoryHandle();
     }
 
     Calendar InflationIndex::fixingCalendar() const {
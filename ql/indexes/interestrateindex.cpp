@@ -58,6 +58,7 @@ namespace QuantLib {
 
         registerWith(Settings::instance().evaluationDate());
         registerWith(notifier());
+        resolveHistoryHandle();
     }
 
     Rate InterestRateIndex::fixing(const Date& fixingDate,
@@ -0,0 +1,111 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/indexes/indexmanager.hpp>
+#include <ql/indexes/overnightfixingaccumulator.hpp>
+#include <ql/utilities/null.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace QuantLib {
+
+    OvernightFixingAccumulator::OvernightFixingAccumulator(std::string indexName,
+                                                           Calendar fixingCalendar,
+                                                           DayCounter dayCounter,
+                                                           Natural fixingDays)
+    : indexName_(std::move(indexName)), fixingCalendar_(std::move(fixingCalendar)),
+      dayCounter_(std::move(dayCounter)), fixingDays_(fixingDays),
+      products_(1, 1.0), sums_(1, 0.0), missing_(1, 0) {
+        registerWith(IndexManager::instance().notifier(indexName_));
+        synchronize(IndexManager::instance().getHistory(indexName_));
+    }
+
+    void OvernightFixingAccumulator::update() {
+        // the history is notified after it was modified
+        synchronize(IndexManager::instance().getHistory(indexName_));
+    }
+
+    void OvernightFixingAccumulator::synchronize(const TimeSeries<Real>& fixings) {
+        if (fixings.empty()) {
+            dates_.clear();
+            fixings_.clear();
+            products_.resize(1);
+            sums_.resize(1);
+            missing_.resize(1);
+            return;
+        }
+
+        // the accumulated values are kept up to the first changed fixing
+        const Date first = fixingCalendar_.adjust(fixings.firstDate());
+        Size k = 0;
+        if (!dates_.empty() && dates_.front() == first) {
+            auto f = fixings.begin();
+            while (k < fixings_.size()) {
+                while (f != fixings.end() && f->first < dates_[k])
+                    ++f;
+                const Real fixing =
+                    (f != fixings.end() && f->first == dates_[k]) ? f->second : Null<Real>();
+                if (fixing != fixings_[k])
+                    break;
+                ++k;
+            }
+        }
+
+        // the dates after the last fixing are only used as value dates
+        const Date last = fixings.lastDate();
+        dates_.resize(k);
+        fixings_.resize(k);
+        Date d = k == 0 ? first : fixingCalendar_.advance(dates_.back(), 1, Days);
+        while (d <= last) {
+            dates_.push_back(d);
+            fixings_.push_back(fixings[d]);
+            d = fixingCalendar_.advance(d, 1, Days);
+        }
+        for (Size j=0; j<=fixingDays_; ++j) {
+            dates_.push_back(d);
+            d = fixingCalendar_.advance(d, 1, Days);
+        }
+
+        const Size n = fixings_.size();
+        products_.resize(n+1);
+        sums_.resize(n+1);
+        missing_.resize(n+1);
+        for (Size j=k; j<n; ++j) {
+            const Real fixing = fixings_[j];
+            if (fixing == Null<Real>()) {
+                products_[j+1] = products_[j];
+                sums_[j+1] = sums_[j];
+                missing_[j+1] = missing_[j] + 1;
+            } else {
+                const Time tau = dayCounter_.yearFraction(dates_[j + fixingDays_],
+                                                          dates_[j + fixingDays_ + 1]);
+                products_[j+1] = products_[j] * (1.0 + fixing * tau);
+                sums_[j+1] = sums_[j] + fixing * tau;
+                missing_[j+1] = missing_[j];
+            }
+        }
+    }
+
+    Size OvernightFixingAccumulator::position(const Date& fixingDate) const {
+        const auto end = dates_.begin() + fixings_.size();
+        const auto i = std::lower_bound(dates_.begin(), end, fixingDate);
+        if (i == end || *i != fixingDate)
+            return Null<Size>();
+        return i - dates_.begin();
+    }
+
+}
@@ -0,0 +1,119 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file overnightfixingaccumulator.hpp
+    \brief cumulative compounding factors of past overnight fixings
+*/
+
+#ifndef quantlib_overnight_fixing_accumulator_hpp
+#define quantlib_overnight_fixing_accumulator_hpp
+
+#include <ql/patterns/observable.hpp>
+#include <ql/time/calendar.hpp>
+#include <ql/time/daycounter.hpp>
+#include <ql/timeseries.hpp>
+#include <string>
+#include <vector>
+
+namespace QuantLib {
+
+    //! cumulative compounding factors of past overnight fixings
+    /*! For each fixing date \f$ d_j \f$ between the first and the last
+        stored fixing of an overnight index, this class stores the
+        cumulative products
+        \f[
+            P_k = \prod_{j<k} \left( 1 + f_j \tau_j \right)
+        \f]
+        and the cumulative sums \f$ S_k = \sum_{j<k} f_j \tau_j \f$,
+        where \f$ f_j \f$ is the fixing at \f$ d_j \f$ and \f$ \tau_j \f$
+        is the accrual period between its value date and the value
+        date of the next fixing.  The compounding factor or the
+        accumulated rate over any range of consecutive fixings is
+        then obtained in constant time.
+
+        The accumulated values are built on construction and brought
+        up to date when the fixing history of the index notifies a
+        change; the values before the first changed fixing are kept,
+        so that adding the latest fixing only requires a single
+        product to be calculated.  The inspectors don't modify the
+        accumulator, so that they can be called concurrently.
+
+        \note missing fixings are allowed in the history; the
+              hasFixings() method can be used to check that a range
+              doesn't contain any.
+    */
+    class OvernightFixingAccumulator : public Observer {
+      public:
+        OvernightFixingAccumulator(std::string indexName,
+                                   Calendar fixingCalendar,
+                                   DayCounter dayCounter,
+                                   Natural fixingDays);
+        //! \name Observer interface
+        //@{
+        void update() override;
+        //@}
+        //! \name Inspectors
+        //@{
+        //! number of fixing dates between the first and last fixing
+        Size size() const { return fixings_.size(); }
+        //! the fixing date at the given position
+        const Date& date(Size position) const { return dates_[position]; }
+        /*! the position of the given fixing date, or Null<Size>() if
+            it's not a fixing date between the first and last fixing.
+        */
+        Size position(const Date& fixingDate) const;
+        //! whether the n fixings starting at the given position are available
+        bool hasFixings(Size from, Size n) const;
+        //! \f$ \prod (1 + f_j \tau_j) \f$ over the n fixings starting at the given position
+        Real compoundFactor(Size from, Size n) const;
+        //! \f$ \sum f_j \tau_j \f$ over the n fixings starting at the given position
+        Real accumulatedRate(Size from, Size n) const;
+        //@}
+      private:
+        //! updates the accumulated values after a change of the fixings
+        void synchronize(const TimeSeries<Real>& fixings);
+
+        std::string indexName_;
+        Calendar fixingCalendar_;
+        DayCounter dayCounter_;
+        Natural fixingDays_;
+        // fixing dates, followed by the dates needed for the last value dates
+        std::vector<Date> dates_;
+        std::vector<Real> fixings_;
+        // cumulative values; the k-th element covers the first k fixings
+        std::vector<Real> products_, sums_;
+        std::vector<Size> missing_;
+    };
+
+
+    // inline definitions
+
+    inline bool OvernightFixingAccumulator::hasFixings(Size from, Size n) const {
+        return missing_[from + n] == missing_[from];
+    }
+
+    inline Real OvernightFixingAccumulator::compoundFactor(Size from, Size n) const {
+        return products_[from + n] / products_[from];
+    }
+
+    inline Real OvernightFixingAccumulator::accumulatedRate(Size from, Size n) const {
+        return sums_[from + n] - sums_[from];
+    }
+
+}
+
+#endif
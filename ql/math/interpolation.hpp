@@ -35,6 +35,59 @@
 
 namespace QuantLib {
 
+    namespace detail {
+
+        // the interval containing x, clamped to the first and last one
+        // for points outside the grid; the last interval also contains
+        // its right end.  The index i is only checked if it's valid.
+        template <class I>
+        bool intervalContains(const I& xBegin, Size n, Real x, Size i) {
+            return i < n-1 && xBegin[i] <= x && (i == n-2 || x < xBegin[i+1]);
+        }
+
+        template <class I>
+        Size locateFrom(const I& xBegin, const I& xEnd, Real x) {
+            const Size n = xEnd - xBegin;
+            // direct guess, exact on uniform grids; it is skipped for
+            // user-defined Real types, which might not be convertible
+            // to integers
+            if constexpr (std::is_arithmetic<Real>::value) {
+                Real guess = (n-1) * ((x - xBegin[0]) / (xBegin[n-1] - xBegin[0]));
+                if (guess >= 0.0 && guess < Real(n-1)) {
+                    auto i = static_cast<Size>(guess);
+                    if (intervalContains(xBegin, n, x, i))
+                        return i;
+                    if (i > 0 && intervalContains(xBegin, n, x, i-1))
+                        return i-1;
+                    if (intervalContains(xBegin, n, x, i+1))
+                        return i+1;
+                }
+            }
+            return std::upper_bound(xBegin, xEnd-1, x) - xBegin - 1;
+        }
+
+        //! locates the interval of a sorted grid containing a given point
+        /*! Returns the index \f$ i \f$ such that
+            \f$ x_i \leq x < x_{i+1} \f$, clamped to the first and
+            last interval for points outside the grid.  The result is
+            the same as a binary search; however, a direct guess which
+            is exact for uniform grids is tried first, so that lookups
+            on (near-)uniform grids take constant time.
+
+            \pre the grid must have at least two points.
+        */
+        template <class I>
+        Size locate(const I& xBegin, const I& xEnd, Real x) {
+            const Size n = xEnd - xBegin;
+            if (x < xBegin[0])
+                return 0;
+            if (x > xBegin[n-1])
+                return n-2;
+            return locateFrom(xBegin, xEnd, x);
+        }
+
+    }
+
     //! base class for 1-D interpolations.
     /*! Classes derived from this class will provide interpolated
         values from two sequences of equal length, representing
@@ -106,12 +159,7 @@ namespace QuantLib {
                 for (I1 i=xBegin_, j=xBegin_+1; j!=xEnd_; ++i, ++j)
                     QL_REQUIRE(*j > *i, "unsorted x values");
                 #endif
-                if (x < *xBegin_)
-                    return 0;
-                else if (x > *(xEnd_-1))
-                    return xEnd_-xBegin_-2;
-                else
-                    return std::upper_bound(xBegin_,xEnd_-1,x)-xBegin_-1;
+                return detail::locate(xBegin_, xEnd_, x);
             }
             I1 xBegin_, xEnd_;
             I2 yBegin_;
@@ -123,6 +171,19 @@ namespace QuantLib {
             checkRange(x,allowExtrapolation);
             return impl_->value(x);
         }
+        //! evaluates the interpolation on a range of points
+        /*! The results are written to the output iterator, which is
+            returned after having been advanced past the last one.
+        */
+        template <class I, class O>
+        O operator()(I xBegin, I xEnd, O out,
+                     bool allowExtrapolation = false) const {
+            for (; xBegin != xEnd; ++xBegin, ++out) {
+                checkRange(*xBegin, allowExtrapolation);
+                *out = impl_->value(*xBegin);
+            }
+            return out;
+        }
         Real primitive(Real x, bool allowExtrapolation = false) const {
             checkRange(x,allowExtrapolation);
             return impl_->primitive(x);
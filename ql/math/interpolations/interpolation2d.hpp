@@ -25,8 +25,7 @@
 #ifndef quantlib_interpolation2D_hpp
 #define quantlib_interpolation2D_hpp
 
-#include <ql/math/interpolations/extrapolation.hpp>
-#include <ql/math/comparison.hpp>
+#include <ql/math/interpolation.hpp>
 #include <ql/math/matrix.hpp>
 #include <ql/errors.hpp>
 #include <ql/types.hpp>
@@ -113,24 +112,14 @@ namespace QuantLib {
                 for (I1 i=xBegin_, j=xBegin_+1; j!=xEnd_; ++i, ++j)
                     QL_REQUIRE(*j > *i, "unsorted x values");
                 #endif
-                if (x < *xBegin_)
-                    return 0;
-                else if (x > *(xEnd_-1))
-                    return xEnd_-xBegin_-2;
-                else
-                    return std::upper_bound(xBegin_,xEnd_-1,x)-xBegin_-1;
+                return detail::locate(xBegin_, xEnd_, x);
             }
             Size locateY(Real y) const override {
 #if defined(QL_EXTRA_SAFETY_CHECKS)
                 for (I2 k=yBegin_, l=yBegin_+1; l!=yEnd_; ++k, ++l)
                     QL_REQUIRE(*l > *k, "unsorted y values");
                 #endif
-                if (y < *yBegin_)
-                    return 0;
-                else if (y > *(yEnd_-1))
-                    return yEnd_-yBegin_-2;
-                else
-                    return std::upper_bound(yBegin_,yEnd_-1,y)-yBegin_-1;
+                return detail::locate(yBegin_, yEnd_, y);
             }
             I1 xBegin_, xEnd_;
             I2 yBegin_, yEnd_;
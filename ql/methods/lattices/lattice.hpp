@@ -70,6 +70,11 @@ namespace QuantLib {
         void initialize(DiscretizedAsset&, Time t) const override;
         void rollback(DiscretizedAsset&, Time to) const override;
         void partialRollback(DiscretizedAsset&, Time to) const override;
+        /*! The assets are rolled back together, so that descendants,
+            probabilities and discount factors are computed once per
+            node and shared between them. */
+        void jointRollback(const std::vector<DiscretizedAsset*>&,
+                           Time to) const override;
         //! Computes the present value of an asset using Arrow-Debrew prices
         Real presentValue(DiscretizedAsset&) const override;
         //@}
@@ -79,10 +84,18 @@ namespace QuantLib {
         void stepback(Size i,
                       const Array& values,
                       Array& newValues) const;
+        void stepback(Size i,
+                      const std::vector<const Array*>& values,
+                      const std::vector<Array*>& newValues) const;
 
       protected:
         void computeStatePrices(Size until) const;
 
+        /* Minimum number of nodes for which a rollback step is
+           parallelized when OpenMP is enabled; on smaller levels,
+           starting a parallel region costs more than the step. */
+        static constexpr long minParallelSize = 1024;
+
         // Arrow-Debrew state prices
         mutable std::vector<Array> statePrices_;
 
@@ -152,22 +165,84 @@ namespace QuantLib {
         auto iFrom = Integer(t_.index(from));
         auto iTo = Integer(t_.index(to));
 
+        // the buffer is swapped with the asset values at each step, so
+        // that memory is only allocated when the tree size changes
+        Array newValues;
         for (Integer i=iFrom-1; i>=iTo; --i) {
-            Array newValues(this->impl().size(i));
+            Size size = this->impl().size(i);
+            if (newValues.size() != size)
+                newValues = Array(size);
             this->impl().stepback(i, asset.values(), newValues);
             asset.time() = t_[i];
-            asset.values() = newValues;
+            asset.values().swap(newValues);
             // skip the very last adjustment
             if (i != iTo)
                 asset.adjustValues();
         }
     }
 
+    template <class Impl>
+    void TreeLattice<Impl>::jointRollback(
+                                   const std::vector<DiscretizedAsset*>& assets,
+                                   Time to) const {
+
+        auto iTo = Integer(t_.index(to));
+
+        // each asset joins the rollback at the level of its own time
+        std::vector<Integer> iFrom(assets.size());
+        Integer iStart = iTo;
+        for (Size k=0; k<assets.size(); ++k) {
+            Time from = assets[k]->time();
+            QL_REQUIRE(from > to || close(from,to),
+                       "cannot roll the asset back to" << to
+                       << " (it is already at t = " << from << ")");
+            iFrom[k] = close(from,to) ? iTo : Integer(t_.index(from));
+            iStart = std::max(iStart, iFrom[k]);
+        }
+
+        std::vector<Array> buffers(assets.size());
+        std::vector<Size> active;
+        std::vector<const Array*> values;
+        std::vector<Array*> newValues;
+        for (Integer i=iStart-1; i>=iTo; --i) {
+            Size size = this->impl().size(i);
+            active.clear();
+            values.clear();
+            newValues.clear();
+            for (Size k=0; k<assets.size(); ++k) {
+                if (iFrom[k] > i) {
+                    if (buffers[k].size() != size)
+                        buffers[k] = Array(size);
+                    active.push_back(k);
+                    values.push_back(&assets[k]->values());
+                    newValues.push_back(&buffers[k]);
+                }
+            }
+            stepback(i, values, newValues);
+            // all the assets are moved to the new time before any is
+            // adjusted, since an adjustment can look at other assets
+            // (e.g., an option at its underlying)
+            for (Size k : active) {
+                assets[k]->time() = t_[i];
+                assets[k]->values().swap(buffers[k]);
+            }
+            // the last adjustment is performed below for all assets
+            if (i != iTo) {
+                for (Size k : active)
+                    assets[k]->adjustValues();
+            }
+        }
+
+        for (auto* asset : assets)
+            asset->adjustValues();
+    }
+
     template <class Impl>
     void TreeLattice<Impl>::stepback(Size i, const Array& values,
                                      Array& newValues) const {
-        #pragma omp parallel for
-        for (long j=0; j<(long)this->impl().size(i); j++) {
+        const auto size = static_cast<long>(this->impl().size(i));
+        #pragma omp parallel for if(size >= minParallelSize)
+        for (long j=0; j<size; j++) {
             Real value = 0.0;
             for (Size l=0; l<n_; l++) {
                 value += this->impl().probability(i,j,l) *
@@ -178,6 +253,28 @@ namespace QuantLib {
         }
     }
 
+    template <class Impl>
+    void TreeLattice<Impl>::stepback(Size i,
+                                     const std::vector<const Array*>& values,
+                                     const std::vector<Array*>& newValues) const {
+        const auto size = static_cast<long>(this->impl().size(i));
+        const Size m = values.size();
+        #pragma omp parallel for if(size*long(m) >= minParallelSize)
+        for (long j=0; j<size; j++) {
+            for (Size k=0; k<m; k++)
+                (*newValues[k])[j] = 0.0;
+            for (Size l=0; l<n_; l++) {
+                Real p = this->impl().probability(i,j,l);
+                Size d = this->impl().descendant(i,j,l);
+                for (Size k=0; k<m; k++)
+                    (*newValues[k])[j] += p * (*values[k])[d];
+            }
+            DiscountFactor discount = this->impl().discount(i,j);
+            for (Size k=0; k<m; k++)
+                (*newValues[k])[j] *= discount;
+        }
+    }
+
 }
 
 
@@ -40,6 +40,18 @@ namespace QuantLib {
                     M[i][j] = counter++;
         }
 
+        // each path uses one point of the sequence, so that starting
+        // at a given path amounts to skipping the points before it
+        SobolRsg sobolSequence(Size dimensionality,
+                               unsigned long seed,
+                               SobolRsg::DirectionIntegers integers,
+                               Size firstPath) {
+            SobolRsg rsg(dimensionality, seed, integers);
+            if (firstPath > 0)
+                rsg.skipTo(static_cast<std::uint32_t>(firstPath));
+            return rsg;
+        }
+
         // variate 2 is used for the second factor's full path
         void fillByDiagonal(std::vector<std::vector<Size> >& M,
                             Size factors, Size steps) {
@@ -202,9 +214,11 @@ namespace QuantLib {
                                                    Size steps,
                                                    Ordering ordering,
                                                    unsigned long seed,
-                                                   SobolRsg::DirectionIntegers integers)
+                                                   SobolRsg::DirectionIntegers integers,
+                                                   Size firstPath)
     : SobolBrownianGeneratorBase(factors, steps, ordering),
-      generator_(SobolRsg(factors * steps, seed, integers), InverseCumulativeNormal()) {}
+      generator_(sobolSequence(factors * steps, seed, integers, firstPath),
+                 InverseCumulativeNormal()) {}
 
     const SobolRsg::sample_type& SobolBrownianGenerator::nextSequence() {
         return generator_.nextSequence();
@@ -213,14 +227,15 @@ namespace QuantLib {
     SobolBrownianGeneratorFactory::SobolBrownianGeneratorFactory(
                                     SobolBrownianGenerator::Ordering ordering,
                                     unsigned long seed,
-                                    SobolRsg::DirectionIntegers integers)
-    : ordering_(ordering), seed_(seed), integers_(integers) {}
+                                    SobolRsg::DirectionIntegers integers,
+                                    Size firstPath)
+    : ordering_(ordering), seed_(seed), integers_(integers), firstPath_(firstPath) {}
 
     ext::shared_ptr<BrownianGenerator>
     SobolBrownianGeneratorFactory::create(Size factors, Size steps) const {
         return ext::shared_ptr<BrownianGenerator>(
                          new SobolBrownianGenerator(factors, steps, ordering_,
-                                                    seed_, integers_));
+                                                    seed_, integers_, firstPath_));
     }
 
     Burley2020SobolBrownianGenerator::Burley2020SobolBrownianGenerator(
@@ -82,25 +82,33 @@ namespace QuantLib {
                                Size steps,
                                Ordering ordering,
                                unsigned long seed = 0,
-                               SobolRsg::DirectionIntegers directionIntegers = SobolRsg::Jaeckel);
+                               SobolRsg::DirectionIntegers directionIntegers = SobolRsg::Jaeckel,
+                               Size firstPath = 0);
 
       private:
         const SobolRsg::sample_type& nextSequence() override;
         InverseCumulativeRsg<SobolRsg, InverseCumulativeNormal> generator_;
     };
 
+    //! Factory of Sobol Brownian generators
+    /*! Generators can start at a given path of the Sobol sequence;
+        this allows to split a simulation into contiguous substreams,
+        e.g., to run them in parallel (see ParallelAccountingEngine).
+    */
     class SobolBrownianGeneratorFactory : public BrownianGeneratorFactory {
       public:
         explicit SobolBrownianGeneratorFactory(
             SobolBrownianGenerator::Ordering ordering,
             unsigned long seed = 0,
-            SobolRsg::DirectionIntegers directionIntegers = SobolRsg::Jaeckel);
+            SobolRsg::DirectionIntegers directionIntegers = SobolRsg::Jaeckel,
+            Size firstPath = 0);
         ext::shared_ptr<BrownianGenerator> create(Size factors, Size steps) const override;
 
       private:
         SobolBrownianGenerator::Ordering ordering_;
         unsigned long seed_;
         SobolRsg::DirectionIntegers integers_;
+        Size firstPath_;
     };
 
     class Burley2020SobolBrownianGenerator : public SobolBrownianGeneratorBase {
@@ -23,6 +23,7 @@
 
 #include <ql/models/marketmodels/driftcomputation/lmmdriftcalculator.hpp>
 #include <ql/models/marketmodels/curvestates/lmmcurvestate.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
@@ -34,7 +35,7 @@ namespace QuantLib {
     : numberOfRates_(taus.size()), numberOfFactors_(pseudo.columns()),
       isFullFactor_(numberOfFactors_ == numberOfRates_), numeraire_(numeraire), alive_(alive),
       displacements_(displacements), oneOverTaus_(taus.size()), pseudo_(pseudo),
-      tmp_(taus.size(), 0.0), e_(pseudo_.columns(), pseudo_.rows(), 0.0), downs_(taus.size()),
+      tmp_(taus.size(), 0.0), e_(pseudo_.rows(), pseudo_.columns(), 0.0), downs_(taus.size()),
       ups_(taus.size()) {
 
         // Check requirements
@@ -125,9 +126,12 @@ namespace QuantLib {
             tmp_[i] = (forwards[i]+displacements_[i]) /
                 (oneOverTaus_[i]+forwards[i]);
 
+        // The workspace e_ is stored by rate, so that the loops over
+        // factors below run over contiguous memory.
+
         // Enforce initialization
-        for (Size r=0; r<numberOfFactors_; ++r)
-            e_[r][std::max(0,static_cast<Integer>(numeraire_)-1)] = 0.0;
+        std::fill(e_.row_begin(numeraire_ > 0 ? numeraire_-1 : 0),
+                  e_.row_end(numeraire_ > 0 ? numeraire_-1 : 0), 0.0);
 
         // Now compute drifts: take the numeraire P_N (numeraire_=N)
         // as the reference point, divide the summation into 3 steps,
@@ -139,42 +143,42 @@ namespace QuantLib {
 
         // 2nd step: then, move backward from N-2 (included) back to
         // alive (included) (if N=0 jumps to 3rd step, if N=numberOfRates_ the
-        // e_[r][N-1] are correctly initialized):
-
+        // e_[N-1][r] are correctly initialized):
         for (Integer i=static_cast<Integer>(numeraire_)-2;
              i>=static_cast<Integer>(alive_); --i) {
-            drifts[i] = 0.0;
+            const Real* p = pseudo_.row_begin(i);
+            const Real* q = pseudo_.row_begin(i+1);
+            const Real* eNext = e_.row_begin(i+1);
+            Real* e = e_.row_begin(i);
+            const Real x = tmp_[i+1];
+            Real drift = 0.0;
             for (Size r=0; r<numberOfFactors_; ++r) {
-                e_[r][i] = e_[r][i+1] + tmp_[i+1] * pseudo_[i+1][r];
-                drifts[i] -= e_[r][i]*pseudo_[i][r];
+                e[r] = eNext[r] + x * q[r];
+                drift -= e[r]*p[r];
             }
-
-            /*
-            Matrix::column_iterator p1 = e_.column_begin(i);
-            Matrix::column_iterator end = e_.column_end(i);
-            Matrix::const_column_iterator p2 = e_.column_begin(i+1);
-            Matrix::const_row_iterator q1 = pseudo_.row_begin(i);
-            Matrix::const_row_iterator q2 = pseudo_.row_begin(i+1);
-            Real x = tmp_[i+1];
-            while (p1 != end) {
-                *p1 = *p2 + x*(*q2);
-                drifts[i] -= *p1*(*q1);
-                ++p1; ++p2; ++q1; ++q2;
-            }
-            */
+            drifts[i] = drift;
         }
 
         // 3rd step: now, move forward from N (included) up to n (excluded)
         // (if N=0 this is the only relevant computation):
         for (Size i=numeraire_; i<numberOfRates_; ++i) {
-            drifts[i] = 0.0;
-            for (Size r=0; r<numberOfFactors_; ++r) {
-                if (i==0)
-                    e_[r][i] = tmp_[i] * pseudo_[i][r];
-                else
-                    e_[r][i] = e_[r][i-1] + tmp_[i] * pseudo_[i][r];
-                drifts[i] += e_[r][i]*pseudo_[i][r];
+            const Real* p = pseudo_.row_begin(i);
+            Real* e = e_.row_begin(i);
+            const Real x = tmp_[i];
+            Real drift = 0.0;
+            if (i==0) {
+                for (Size r=0; r<numberOfFactors_; ++r) {
+                    e[r] = x * p[r];
+                    drift += e[r]*p[r];
+                }
+            } else {
+                const Real* ePrev = e_.row_begin(i-1);
+                for (Size r=0; r<numberOfFactors_; ++r) {
+                    e[r] = ePrev[r] + x * p[r];
+                    drift += e[r]*p[r];
+                }
             }
+            drifts[i] = drift;
         }
     }
 
@@ -117,12 +117,9 @@ namespace QuantLib {
         const std::vector<Real>& fixedDrift = fixedDrifts_[currentStep_];
 
         Integer alive = alive_[currentStep_];
-        Real drifts2;
         for (Integer i=numberOfRates_-1; i>=alive; --i) {
-            drifts2 = 0.0;
-            for (Size j=i+1; j<numberOfRates_; ++j) {
-                drifts2 -= g_[j]*C[i][j];
-            }
+            Real drifts2 = -std::inner_product(g_.begin()+i+1, g_.end(),
+                                               C.row_begin(i)+i+1, Real(0.0));
             logForwards_[i] += 0.5*(drifts1_[i]+drifts2) + fixedDrift[i];
             logForwards_[i] +=
                 std::inner_product(A.row_begin(i), A.row_end(i),
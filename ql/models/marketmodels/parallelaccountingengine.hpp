@@ -0,0 +1,137 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file parallelaccountingengine.hpp
+    \brief market-model simulation split over independent path streams
+*/
+
+#ifndef quantlib_parallel_accounting_engine_hpp
+#define quantlib_parallel_accounting_engine_hpp
+
+#include <ql/errors.hpp>
+#include <ql/math/statistics/sequencestatistics.hpp>
+#include <ql/shared_ptr.hpp>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Accounting engine running several path streams in parallel
+    /*! The simulated paths are split into contiguous blocks, one for
+        each stream.  Each stream is simulated by its own engine
+        (e.g., an AccountingEngine or a PathwiseAccountingEngine)
+        built by the given factory, which receives the index of the
+        first path of the block; the factory should give each engine
+        its own evolver and Brownian generator, drawing the paths of
+        that block---for instance, by means of a
+        SobolBrownianGeneratorFactory starting at the given path.
+        The product is cloned by each engine.
+
+        The streams are run in parallel when QuantLib is compiled
+        with OpenMP support.  Their results are added to the
+        statistics in a fixed order, so that they only depend on the
+        number of streams and not on the number of threads.
+
+        \pre the engine must provide the singlePathValues() and
+             numberOfValues() methods; the factory is only called
+             from the calling thread.
+    */
+    template <class Engine>
+    class ParallelAccountingEngine {
+      public:
+        typedef std::function<ext::shared_ptr<Engine>(Size firstPath)> EngineFactory;
+
+        ParallelAccountingEngine(EngineFactory factory,
+                                 Size numberOfStreams,
+                                 Size batchSize = 1024)
+        : factory_(std::move(factory)), numberOfStreams_(numberOfStreams),
+          batchSize_(batchSize) {
+            QL_REQUIRE(numberOfStreams_ > 0, "at least one stream required");
+            QL_REQUIRE(batchSize_ > 0, "positive batch size required");
+        }
+
+        void multiplePathValues(SequenceStatisticsInc& stats,
+                                Size numberOfPaths) const;
+      private:
+        EngineFactory factory_;
+        Size numberOfStreams_, batchSize_;
+    };
+
+
+    // template definitions
+
+    template <class Engine>
+    void ParallelAccountingEngine<Engine>::multiplePathValues(
+                                                SequenceStatisticsInc& stats,
+                                                Size numberOfPaths) const {
+        const Size streams = numberOfStreams_;
+        const Size pathsPerStream = (numberOfPaths + streams - 1) / streams;
+
+        std::vector<ext::shared_ptr<Engine> > engines(streams);
+        std::vector<Size> pathsInStream(streams);
+        for (Size k=0; k<streams; ++k) {
+            const Size firstPath = std::min(k*pathsPerStream, numberOfPaths);
+            pathsInStream[k] =
+                std::min(firstPath + pathsPerStream, numberOfPaths) - firstPath;
+            engines[k] = factory_(firstPath);
+        }
+
+        // the values of a batch of paths for each stream; they are
+        // stored so that they can be added to the statistics in order
+        const Size numberOfValues = engines.front()->numberOfValues();
+        const Size batchSize = std::min(batchSize_, pathsPerStream);
+        std::vector<std::vector<std::vector<Real> > > values(
+            streams, std::vector<std::vector<Real> >(
+                         batchSize, std::vector<Real>(numberOfValues)));
+        std::vector<std::vector<Real> > weights(streams,
+                                                std::vector<Real>(batchSize));
+        auto pathsInBatch = [&](Size k, Size start) {
+            return std::min(start + batchSize,
+                            std::max(pathsInStream[k], start)) - start;
+        };
+
+        for (Size start=0; start<pathsPerStream; start+=batchSize) {
+            std::exception_ptr error;
+            #pragma omp parallel for if(streams > 1)
+            for (long k=0; k<long(streams); ++k) {
+                const Size paths = pathsInBatch(k, start);
+                try {
+                    for (Size i=0; i<paths; ++i)
+                        weights[k][i] = engines[k]->singlePathValues(values[k][i]);
+                } catch (...) {
+                    #pragma omp critical
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+                std::rethrow_exception(error);
+
+            for (Size k=0; k<streams; ++k) {
+                const Size paths = pathsInBatch(k, start);
+                for (Size i=0; i<paths; ++i)
+                    stats.add(values[k][i], weights[k][i]);
+            }
+        }
+    }
+
+}
+
+#endif
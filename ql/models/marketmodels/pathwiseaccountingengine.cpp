@@ -742,23 +742,18 @@ namespace QuantLib {
 
         numberBumps_ = vegaBumps[0].size();
 
-       std::vector<Matrix> jacobiansThisPathsModel;
-       jacobiansThisPathsModel.reserve(numberRates_);
-       for (Size i =0; i < numberRates_; ++i)
-           jacobiansThisPathsModel.emplace_back(numberRates_, factors_);
-
-
         for (Size i =0; i < numberSteps_; ++i)
         {
             jacobianComputers_.emplace_back(
                 pseudoRootStructure_->pseudoRoot(i), evolution.firstAliveRate()[i], numeraires_[i],
                 evolution.rateTaus(), pseudoRootStructure_->displacements());
-
-            // vector of vector of matrices to store jacobians of rates with respect to pseudo-root
-            // elements
-            jacobiansThisPaths_.push_back(jacobiansThisPathsModel);
         }
 
+        // what the adjoint computation of vegas needs from the forward sweep
+        ratesThisPath_.resize(numberSteps_+1, std::vector<Rate>(numberRates_));
+        stepsDiscountsThisPath_.resize(numberSteps_, std::vector<Real>(numberRates_+1));
+        browniansThisPath_.resize(numberSteps_, std::vector<Real>(factors_));
+
 
 
         Matrix VModel(numberSteps_+1,numberRates_);
@@ -915,11 +910,10 @@ namespace QuantLib {
                 Discounts_[storeStep][i+1] = evolver_->currentState().discountRatio(i+1,0);
             }
 
-            jacobianComputers_[thisStep].getBumps(lastForwards_,
-                                         stepsDiscounts_,
-                                         currentForwards_,
-                                         evolver_->browniansThisStep(),
-                                         jacobiansThisPaths_[thisStep]);
+            ratesThisPath_[thisStep] = lastForwards_;
+            ratesThisPath_[storeStep] = currentForwards_;
+            stepsDiscountsThisPath_[thisStep] = stepsDiscounts_;
+            browniansThisPath_[thisStep] = evolver_->browniansThisStep();
 
 //            gaussians_[thisStep] = evolver_->browniansThisStep();
 
@@ -1055,35 +1049,26 @@ namespace QuantLib {
         } // end of  for (Integer currentStep =  numberSteps_-1; currentStep >=0 ; --currentStep)
 
 
-        // all V matrices computed we now compute the elementary vegas for this path 
+        // all V matrices computed we now compute the elementary vegas for this path
 
         for (Size i=0; i < numberProducts_; ++i)
         {
                 for (Size j=0; j < numberSteps_; ++j)
                 {
-                    Size nextIndex = j+1;
-
                     // we know V, we need to pair against the senstivity of the rate to the elementary vega
-                    // note the simplification here arising from the fact that the elementary vega affects the evolution on precisely one step
-
-                    for (Size k=0; k < numberRates_; ++k)
-                        for (Size f=0; f < factors_; ++f)
-                        {
-                                Real sensitivity =0.0;
-
-                                for (Size r=0; r < numberRates_; ++r)
-                                {
-                                        sensitivity += V_[i][nextIndex][r]*jacobiansThisPaths_[j][r][k][f];
-
-                                  }
-/*
-                                  if (j ==distinguishedStep_ && k ==distinguishedRate_ &&f== distinguishedFactor_)
-                                      std::cout << sensitivity << "," <<  jacobiansThisPaths_[j][j][k][f] << "," << gaussians_[j][f] << "," << V_[i][nextIndex][j] << "," << LIBORRates_[nextIndex][j] << "\n";
-  */                
-
-
-                                elementary_vegas_ThisPath_[i][j][k][f] = sensitivity;
-                        }
+                    // note the simplification here arising from the fact that the elementary vega affects the evolution on precisely one step;
+                    // the pairing is done by an adjoint sweep, without forming the Jacobian of the rates
+
+                    if (Integer(j) <= finalStepDone)
+                        jacobianComputers_[j].getWeightedBumps(ratesThisPath_[j],
+                                                               stepsDiscountsThisPath_[j],
+                                                               ratesThisPath_[j+1],
+                                                               browniansThisPath_[j],
+                                                               V_[i].row_begin(j+1),
+                                                               elementary_vegas_ThisPath_[i][j]);
+                    else // the path ended before this step
+                        std::fill(elementary_vegas_ThisPath_[i][j].begin(),
+                                  elementary_vegas_ThisPath_[i][j].end(), 0.0);
                 }
         }
 
@@ -53,9 +53,11 @@ namespace QuantLib {
 
         void multiplePathValues(SequenceStatisticsInc& stats,
                                 Size numberOfPaths);
+        //! simulates the next path and returns its weight
+        /*! \pre values must have numberOfValues() elements */
+        Real singlePathValues(std::vector<Real>& values);
+        Size numberOfValues() const { return numberProducts_*(numberRates_+1); }
       private:
-          Real singlePathValues(std::vector<Real>& values);
-
         ext::shared_ptr<LogNormalFwdRateEuler> evolver_;
         Clone<MarketModelPathwiseMultiProduct> product_;
         ext::shared_ptr<MarketModel> pseudoRootStructure_;
@@ -258,7 +260,9 @@ namespace QuantLib {
         Matrix partials_; // dimensions are factor and rate
 
         std::vector<std::vector<Matrix>   > elementary_vegas_ThisPath_;  // dimensions are product, step,  rate and factor
-        std::vector<std::vector<Matrix> > jacobiansThisPaths_;                      // dimensions are step, rate, rate and factor
+        std::vector<std::vector<Rate> > ratesThisPath_;  // dimensions are step and rate, goes from 0 to numberSteps_
+        std::vector<std::vector<Real> > stepsDiscountsThisPath_;  // dimensions are step and rate
+        std::vector<std::vector<Real> > browniansThisPath_;  // dimensions are step and factor
 
         std::vector<Real> deflatorAndDerivatives_;
         std::vector<Real> fullDerivatives_;
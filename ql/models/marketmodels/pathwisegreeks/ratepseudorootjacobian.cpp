@@ -21,6 +21,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 
 
 #include <ql/models/marketmodels/pathwisegreeks/ratepseudorootjacobian.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib
@@ -239,7 +240,8 @@ namespace QuantLib
     : pseudoRoot_(pseudoRoot), aliveIndex_(aliveIndex), taus_(taus),
       displacements_(std::move(displacements)), factors_(pseudoRoot.columns()),
       //   bumpedRates_(taus.size()),
-      e_(pseudoRoot.rows(), pseudoRoot.columns()), ratios_(taus_.size()) {
+      e_(pseudoRoot.rows(), pseudoRoot.columns()), ratios_(taus_.size()),
+      weightedSums_(pseudoRoot.columns()) {
         Size numberRates= taus.size();
 
         QL_REQUIRE(aliveIndex == numeraire,
@@ -312,6 +314,55 @@ namespace QuantLib
             }
     }
 
+
+    void RatePseudoRootJacobianAllElements::getWeightedBumps(
+                                        const std::vector<Rate>& oldRates,
+                                        const std::vector<Real>& discountRatios,
+                                        const std::vector<Rate>& newRates,
+                                        const std::vector<Real>& gaussians,
+                                        Matrix::const_row_iterator weights,
+                                        Matrix& S) {
+        Size numberRates = taus_.size();
+
+        QL_REQUIRE(S.rows() == numberRates && S.columns() == factors_,
+                   "we need S to be a " << numberRates << " x " << factors_
+                   << " matrix, not " << S.rows() << " x " << S.columns());
+
+        for (Size j = aliveIndex_; j < numberRates; ++j)
+            ratios_[j] = (oldRates[j] + displacements_[j]) * discountRatios[j + 1];
+
+        for (Size f = 0; f < factors_; ++f) {
+            e_[aliveIndex_][f] = 0;
+
+            for (Size j = aliveIndex_ + 1; j < numberRates; ++j)
+                e_[j][f] = e_[j - 1][f] + ratios_[j - 1] * pseudoRoot_[j - 1][f];
+        }
+
+        // Each pseudo-root element A[k][f] enters rate k through its
+        // own evolution and each rate j > k through the drift, with a
+        // derivative proportional to A[j][f]; the latter terms are
+        // collected by a backward sweep over the rates.
+        std::fill(weightedSums_.begin(), weightedSums_.end(), 0.0);
+
+        for (Integer k = Integer(numberRates) - 1; k >= Integer(aliveIndex_); --k) {
+            const Real* a = pseudoRoot_.row_begin(k);
+            const Real* e = e_.row_begin(k);
+            Real* s = S.row_begin(k);
+            const Real w = weights[k];
+            const Real x = ratios_[k]*taus_[k];
+            const Real diagonal = w*(newRates[k]+displacements_[k]);
+            const Real drift = w*newRates[k];
+            for (Size f = 0; f < factors_; ++f) {
+                s[f] = diagonal*(2*x*a[f] - a[f] + e[f]*taus_[k] + gaussians[f])
+                    + x*weightedSums_[f];
+                weightedSums_[f] += drift*a[f];
+            }
+        }
+
+        // rates that have already reset don't depend on the pseudo-root
+        for (Size k = 0; k < aliveIndex_; ++k)
+            std::fill(S.row_begin(k), S.row_end(k), 0.0);
+    }
     
 }
 
@@ -136,6 +136,20 @@ namespace QuantLib
                         B); // one Matrix for each rate, the elements of the matrix are the
                             // derivatives of that rate with respect to each pseudo-root element
 
+      /*! Adjoint version of getBumps: computes the derivatives of
+          \f$ \sum_j w_j F_j \f$, where \f$ F_j \f$ are the new rates
+          and \f$ w_j \f$ the given weights, with respect to each
+          pseudo-root element; that is, S[k][f] = sum_j w_j B[j][k][f].
+          The Jacobian is never formed, so that the cost is linear
+          rather than quadratic in the number of rates.
+      */
+      void getWeightedBumps(const std::vector<Rate>& oldRates,
+                            const std::vector<Real>& oneStepDFs,
+                            const std::vector<Rate>& newRates,
+                            const std::vector<Real>& gaussians,
+                            Matrix::const_row_iterator weights,
+                            Matrix& S);
+
     private:
 
         //! this data does not change after construction
@@ -150,6 +164,7 @@ namespace QuantLib
 
         Matrix e_;
         std::vector<Real> ratios_;
+        std::vector<Real> weightedSums_;
    
     };
 
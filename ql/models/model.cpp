@@ -23,6 +23,7 @@
 #include <ql/math/optimization/projection.hpp>
 #include <ql/models/model.hpp>
 #include <ql/utilities/null_deleter.hpp>
+#include <exception>
 #include <utility>
 
 using std::vector;
@@ -37,29 +38,27 @@ namespace QuantLib {
         CalibrationFunction(CalibratedModel* model,
                             const vector<ext::shared_ptr<CalibrationHelper> >& h,
                             vector<Real> weights,
-                            const Projection& projection)
+                            const Projection& projection,
+                            bool parallel = false)
         : model_(model, null_deleter()), instruments_(h), weights_(std::move(weights)),
-          projection_(projection) {}
+          projection_(projection), parallel_(parallel) {}
 
         ~CalibrationFunction() override = default;
 
         Real value(const Array& params) const override {
             model_->setParams(projection_.include(params));
+            Array errors = calibrationErrors();
             Real value = 0.0;
-            for (Size i=0; i<instruments_.size(); i++) {
-                Real diff = instruments_[i]->calibrationError();
-                value += diff*diff*weights_[i];
-            }
+            for (Size i=0; i<instruments_.size(); i++)
+                value += errors[i]*errors[i]*weights_[i];
             return std::sqrt(value);
         }
 
         Array values(const Array& params) const override {
             model_->setParams(projection_.include(params));
-            Array values(instruments_.size());
-            for (Size i=0; i<instruments_.size(); i++) {
-                values[i] = instruments_[i]->calibrationError()
-                           *std::sqrt(weights_[i]);
-            }
+            Array values = calibrationErrors();
+            for (Size i=0; i<instruments_.size(); i++)
+                values[i] *= std::sqrt(weights_[i]);
             return values;
         }
 
@@ -70,6 +69,30 @@ namespace QuantLib {
         const vector<ext::shared_ptr<CalibrationHelper> >& instruments_;
         vector<Real> weights_;
         const Projection projection_;
+        bool parallel_;
+        mutable bool initialized_ = false;
+
+        Array calibrationErrors() const {
+            const auto n = static_cast<long>(instruments_.size());
+            Array errors(instruments_.size());
+            // the helpers are lazy objects and are not thread safe on
+            // their first evaluation, so that one is done sequentially
+            std::exception_ptr error;
+            #pragma omp parallel for if(parallel_ && initialized_)
+            for (long i=0; i<n; i++) {
+                try {
+                    errors[i] = instruments_[i]->calibrationError();
+                } catch (...) {
+                    #pragma omp critical
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+                std::rethrow_exception(error);
+            initialized_ = true;
+            return errors;
+        }
     };
 
     void CalibratedModel::calibrate(
@@ -102,7 +125,7 @@ namespace QuantLib {
                    fixParameters.size() << ")");
         vector<bool> all(prms.size(), false);
         Projection proj(prms, !fixParameters.empty() ? fixParameters : all);
-        CalibrationFunction f(this,instruments,w,proj);
+        CalibrationFunction f(this, instruments, w, proj, parallelCalibration_);
         ProjectedConstraint pc(c,proj);
         Problem prob(f, pc, proj.project(prms));
         shortRateEndCriteria_ = method.minimize(prob, endCriteria);
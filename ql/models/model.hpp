@@ -121,6 +121,19 @@ namespace QuantLib {
         virtual void setParams(const Array& params);
         Integer functionEvaluation() const { return functionEvaluation_; }
 
+        //! Evaluate the calibration helpers in parallel
+        /*! When the library is compiled with OpenMP support, the
+            calibration errors are computed concurrently for each set
+            of trial parameters.  This is only safe if every helper
+            uses its own pricing engine and if pricing does not
+            trigger the recalculation of objects shared between the
+            helpers (e.g., a lazy model).  The first evaluation is
+            always sequential, so that the lazy initialization of the
+            helpers themselves does not happen concurrently.
+        */
+        void setParallelCalibration(bool flag) { parallelCalibration_ = flag; }
+        bool parallelCalibration() const { return parallelCalibration_; }
+
       protected:
         virtual void generateArguments() {}
         std::vector<Parameter> arguments_;
@@ -128,6 +141,7 @@ namespace QuantLib {
         EndCriteria::Type shortRateEndCriteria_ = EndCriteria::None;
         Array problemValues_;
         Integer functionEvaluation_;
+        bool parallelCalibration_ = false;
 
       private:
         //! Constraint imposed on arguments
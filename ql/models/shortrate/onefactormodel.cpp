@@ -83,6 +83,49 @@ namespace QuantLib {
     : TreeLattice1D<OneFactorModel::ShortRateTree>(timeGrid, tree->size(1)), tree_(tree),
       dynamics_(std::move(dynamics)), spread_(0.0) {}
 
+    void OneFactorModel::ShortRateTree::precomputeDiscounts() const {
+        // the dynamics are fixed once the tree is used; their
+        // discount factors can be reused by every rollback
+        std::call_once(discountsFlag_, [this]() {
+            discounts_.resize(timeGrid().size() - 1);
+            for (Size i=0; i<discounts_.size(); i++) {
+                Time t = timeGrid()[i], dt = timeGrid().dt(i);
+                Array& discounts = discounts_[i];
+                discounts = Array(size(i));
+                for (Size j=0; j<discounts.size(); j++) {
+                    Rate r = dynamics_->shortRate(t, tree_->underlying(i, j));
+                    discounts[j] = std::exp(-r*dt);
+                }
+            }
+            discountsReady_ = true;
+        });
+    }
+
+    void OneFactorModel::ShortRateTree::initialize(DiscretizedAsset& asset,
+                                                   Time t) const {
+        precomputeDiscounts();
+        TreeLattice1D<OneFactorModel::ShortRateTree>::initialize(asset, t);
+    }
+
+    void OneFactorModel::ShortRateTree::stepback(Size i,
+                                                 const Array& values,
+                                                 Array& newValues) const {
+        precomputeDiscounts();
+        const Array& discounts = discounts_[i];
+        DiscountFactor spreadDiscount =
+            spread_ == 0.0 ? 1.0 : std::exp(-spread_*timeGrid().dt(i));
+        const auto size = static_cast<long>(discounts.size());
+        #pragma omp parallel for if(size >= minParallelSize)
+        for (long j=0; j<size; j++) {
+            Real value = 0.0;
+            for (Size l=0; l<TrinomialTree::branches; l++) {
+                value += tree_->probability(i,j,l) *
+                         values[tree_->descendant(i,j,l)];
+            }
+            newValues[j] = value * discounts[j] * spreadDiscount;
+        }
+    }
+
     OneFactorModel::OneFactorModel(Size nArguments)
     : ShortRateModel(nArguments) {}
 
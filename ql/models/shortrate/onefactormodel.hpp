@@ -28,6 +28,8 @@
 #include <ql/methods/lattices/lattice1d.hpp>
 #include <ql/methods/lattices/trinomialtree.hpp>
 #include <ql/models/model.hpp>
+#include <atomic>
+#include <mutex>
 #include <utility>
 
 namespace QuantLib {
@@ -89,6 +91,12 @@ namespace QuantLib {
             return tree_->size(i);
         }
         DiscountFactor discount(Size i, Size index) const {
+            if (discountsReady_) {
+                DiscountFactor d = discounts_[i][index];
+                return spread_ == 0.0 ?
+                    d : d * std::exp(-spread_*timeGrid().dt(i));
+            }
+            // the tree might still be being fitted
             Real x = tree_->underlying(i, index);
             Rate r = dynamics_->shortRate(timeGrid()[i], x) +spread_;
             return std::exp(-r*timeGrid().dt(i));
@@ -102,15 +110,25 @@ namespace QuantLib {
         Real probability(Size i, Size index, Size branch) const {
             return tree_->probability(i, index, branch);
         }
+        void initialize(DiscretizedAsset&, Time t) const override;
+        void stepback(Size i, const Array& values, Array& newValues) const;
         void setSpread(Spread spread)
         {
             spread_=spread;
         }
       private:
+        void precomputeDiscounts() const;
         ext::shared_ptr<TrinomialTree> tree_;
         ext::shared_ptr<ShortRateDynamics> dynamics_;
         class Helper;
         Spread spread_;
+        /* per-level discount factors, excluding the spread.  Some
+           models fit their dynamics after building the tree, so the
+           table is only filled when the first asset is initialized
+           on the tree or rolled back. */
+        mutable std::vector<Array> discounts_;
+        mutable std::once_flag discountsFlag_;
+        mutable std::atomic<bool> discountsReady_{false};
     };
 
     //! Single-factor affine base class
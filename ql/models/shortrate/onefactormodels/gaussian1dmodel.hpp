@@ -91,6 +91,36 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
                   Real y = 0.0,
                   const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
 
+    /*! \name Vectorized evaluation
+        These methods return the results for all the given values of
+        the state variable at once; the parts depending on the times
+        only are computed a single time for the whole array.
+        @{
+    */
+    Array numeraire(Time t,
+                    const Array& y,
+                    const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array zerobond(Time T,
+                   Time t,
+                   const Array& y,
+                   const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array numeraire(const Date& referenceDate,
+                    const Array& y,
+                    const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array zerobond(const Date& maturity,
+                   const Date& referenceDate,
+                   const Array& y,
+                   const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array forwardRate(const Date& fixing,
+                      const Date& referenceDate,
+                      const Array& y,
+                      const ext::shared_ptr<IborIndex>& iborIdx) const;
+    //@}
+
     Real zerobondOption(const Option::Type& type,
                         const Date& expiry,
                         const Date& valueDate,
@@ -188,6 +218,15 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
     virtual Real
     zerobondImpl(Time T, Time t, Real y, const Handle<YieldTermStructure>& yts) const = 0;
 
+    /*! The default implementations call the scalar versions for each
+        value of the state variable; models should override them when
+        the deterministic parts can be factored out. */
+    virtual Array
+    numeraireArrayImpl(Time t, const Array& y, const Handle<YieldTermStructure>& yts) const;
+
+    virtual Array
+    zerobondArrayImpl(Time T, Time t, const Array& y, const Handle<YieldTermStructure>& yts) const;
+
     void performCalculations() const override {
         evaluationDate_ = Settings::instance().evaluationDate();
         enforcesTodaysHistoricFixings_ =
@@ -240,6 +279,19 @@ Gaussian1dModel::zerobond(const Time T, const Time t, const Real y,
     return zerobondImpl(T, t, y, yts);
 }
 
+inline Array
+Gaussian1dModel::numeraire(const Time t, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const {
+
+    return numeraireArrayImpl(t, y, yts);
+}
+
+inline Array
+Gaussian1dModel::zerobond(const Time T, const Time t, const Array &y,
+                          const Handle<YieldTermStructure> &yts) const {
+    return zerobondArrayImpl(T, t, y, yts);
+}
+
 inline Real
 Gaussian1dModel::numeraire(const Date &referenceDate, const Real y,
                            const Handle<YieldTermStructure> &yts) const {
@@ -257,6 +309,24 @@ Gaussian1dModel::zerobond(const Date &maturity, const Date &referenceDate,
                         : 0.0,
                     y, yts);
 }
+
+inline Array
+Gaussian1dModel::numeraire(const Date &referenceDate, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const {
+
+    return numeraire(termStructure()->timeFromReference(referenceDate), y, yts);
+}
+
+inline Array
+Gaussian1dModel::zerobond(const Date &maturity, const Date &referenceDate,
+                          const Array &y, const Handle<YieldTermStructure> &yts) const {
+
+    return zerobond(termStructure()->timeFromReference(maturity),
+                    referenceDate != Date()
+                        ? termStructure()->timeFromReference(referenceDate)
+                        : 0.0,
+                    y, yts);
+}
 }
 
 #endif
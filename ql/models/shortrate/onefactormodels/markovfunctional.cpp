@@ -799,6 +799,40 @@ namespace QuantLib {
                                      termStructure()->discount(T)));
     }
 
+    Array MarkovFunctional::numeraireArrayImpl(
+        const Time t, const Array &y,
+        const Handle<YieldTermStructure> &yts) const {
+
+        if (t == 0)
+            return Array(y.size(),
+                         yts.empty()
+                             ? this->termStructure()->discount(numeraireTime(), true)
+                             : yts->discount(numeraireTime()));
+
+        Array result = numeraireArray(t, y);
+        if (!yts.empty())
+            result *= yts->discount(numeraireTime()) / yts->discount(t) *
+                      termStructure()->discount(t) /
+                      termStructure()->discount(numeraireTime());
+        return result;
+    }
+
+    Array
+    MarkovFunctional::zerobondArrayImpl(const Time T, const Time t, const Array &y,
+                                        const Handle<YieldTermStructure> &yts) const {
+
+        if (t == 0.0)
+            return Array(y.size(), yts.empty() ? this->termStructure()->discount(T, true)
+                                               : yts->discount(T, true));
+
+        Array result = zerobondArray(T, t, y);
+        if (!yts.empty())
+            result *= yts->discount(T) / yts->discount(t) *
+                      termStructure()->discount(t) /
+                      termStructure()->discount(T);
+        return result;
+    }
+
     Real MarkovFunctional::deflatedZerobond(Time T, Time t,
                                             Real y) const {
 
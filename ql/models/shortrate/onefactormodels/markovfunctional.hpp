@@ -377,6 +377,15 @@ namespace QuantLib {
         Real
         zerobondImpl(Time T, Time t, Real y, const Handle<YieldTermStructure>& yts) const override;
 
+        Array numeraireArrayImpl(Time t,
+                                 const Array& y,
+                                 const Handle<YieldTermStructure>& yts) const override;
+
+        Array zerobondArrayImpl(Time T,
+                                Time t,
+                                const Array& y,
+                                const Handle<YieldTermStructure>& yts) const override;
+
         void generateArguments() override {
             ext::static_pointer_cast<MfStateProcess>(stateProcess_)->setVols(sigma_.params());
             if(isCalculated())
@@ -28,6 +28,7 @@
 #include <ql/math/array.hpp>
 #include <ql/timegrid.hpp>
 #include <utility>
+#include <vector>
 
 namespace QuantLib {
 
@@ -84,6 +85,18 @@ namespace QuantLib {
         virtual void partialRollback(DiscretizedAsset&,
                                      Time to) const = 0;
 
+        /*! Roll back a set of assets until the given time, performing
+            any needed adjustment.  The assets can start from different
+            times; each one is rolled back from its own time.  At
+            each time, the assets are adjusted in the given order.
+
+            The default implementation rolls back each asset
+            separately; derived classes can override it so that the
+            work at each node is shared between the assets.
+        */
+        virtual void jointRollback(const std::vector<DiscretizedAsset*>&,
+                                   Time to) const;
+
         //! computes the present value of an asset.
         virtual Real presentValue(DiscretizedAsset&) const = 0;
 
@@ -218,6 +218,201 @@ namespace QuantLib {
             event0Time = std::max(
                 model_->termStructure()->timeFromReference(event0), 0.0);
 
+            // the flows and the exercise value on the event date are
+            // computed on the whole grid at once, so that the
+            // deterministic parts of the model quantities are evaluated
+            // a single time
+            Array zs = event0 > expiry ? z : Array(1, y);
+            Array numeraires, underlyingFlows(zs.size(), 0.0);
+            Real rebateValue = 0.0;
+            if (isEventDate) {
+
+                numeraires = model_->numeraire(event0Time, zs, discountCurve_);
+
+                if (isLeg1Fixing) { // if event is a fixing date and
+                                    // exercise date,
+                    // the coupon is part of the exercise into right (by
+                    // definition)
+                    Size j = std::find(arguments_.leg1FixingDates.begin(),
+                                       arguments_.leg1FixingDates.end(),
+                                       event0) -
+                             arguments_.leg1FixingDates.begin();
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? Real(1.0)
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(
+                                            event0,
+                                            arguments_.leg1PayDates[j])));
+                    bool done = false;
+                    do {
+                        Array amounts(zs.size(), arguments_.leg1Coupons[j]);
+                        if (!arguments_.leg1IsRedemptionFlow[j]) {
+                            Array estFixings(zs.size(), 0.0);
+                            if (ibor1 != nullptr)
+                                estFixings = model_->forwardRate(
+                                    arguments_.leg1FixingDates[j], event0, zs,
+                                    ibor1);
+                            for (Size k = 0; k < zs.size(); k++) {
+                                if (cms1 != nullptr)
+                                    estFixings[k] = model_->swapRate(
+                                        arguments_.leg1FixingDates[j],
+                                        cms1->tenor(), event0, zs[k], cms1);
+                                if (cmsspread1 != nullptr)
+                                    estFixings[k] =
+                                        cmsspread1->gearing1() *
+                                            model_->swapRate(
+                                                arguments_.leg1FixingDates[j],
+                                                cmsspread1->swapIndex1()
+                                                    ->tenor(),
+                                                event0, zs[k],
+                                                cmsspread1->swapIndex1()) +
+                                        cmsspread1->gearing2() *
+                                            model_->swapRate(
+                                                arguments_.leg1FixingDates[j],
+                                                cmsspread1->swapIndex2()
+                                                    ->tenor(),
+                                                event0, zs[k],
+                                                cmsspread1->swapIndex2());
+                                Real rate =
+                                    arguments_.leg1Spreads[j] +
+                                    arguments_.leg1Gearings[j] * estFixings[k];
+                                if (arguments_.leg1CappedRates[j] !=
+                                    Null<Real>())
+                                    rate = std::min(
+                                        arguments_.leg1CappedRates[j], rate);
+                                if (arguments_.leg1FlooredRates[j] !=
+                                    Null<Real>())
+                                    rate = std::max(
+                                        arguments_.leg1FlooredRates[j], rate);
+                                amounts[k] = rate * arguments_.nominal1[j] *
+                                             arguments_.leg1AccrualTimes[j];
+                            }
+                        }
+
+                        Array discounts = model_->zerobond(
+                            arguments_.leg1PayDates[j], event0, zs,
+                            discountCurve_);
+                        for (Size k = 0; k < zs.size(); k++)
+                            underlyingFlows[k] -=
+                                amounts[k] * discounts[k] / numeraires[k] *
+                                zSpreadDf;
+
+                        if (j < arguments_.leg1FixingDates.size() - 1) {
+                            j++;
+                            done =
+                                (event0 != arguments_.leg1FixingDates[j]);
+                        } else
+                            done = true;
+
+                    } while (!done);
+                }
+
+                if (isLeg2Fixing) { // if event is a fixing date and
+                                    // exercise date,
+                    // the coupon is part of the exercise into right (by
+                    // definition)
+                    Size j = std::find(arguments_.leg2FixingDates.begin(),
+                                       arguments_.leg2FixingDates.end(),
+                                       event0) -
+                             arguments_.leg2FixingDates.begin();
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? Real(1.0)
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(
+                                            event0,
+                                            arguments_.leg2PayDates[j])));
+                    bool done = false;
+                    do {
+                        Array amounts(zs.size(), arguments_.leg2Coupons[j]);
+                        if (!arguments_.leg2IsRedemptionFlow[j]) {
+                            Array estFixings(zs.size(), 0.0);
+                            if (ibor2 != nullptr)
+                                estFixings = model_->forwardRate(
+                                    arguments_.leg2FixingDates[j], event0, zs,
+                                    ibor2);
+                            for (Size k = 0; k < zs.size(); k++) {
+                                if (cms2 != nullptr)
+                                    estFixings[k] = model_->swapRate(
+                                        arguments_.leg2FixingDates[j],
+                                        cms2->tenor(), event0, zs[k], cms2);
+                                if (cmsspread2 != nullptr)
+                                    estFixings[k] =
+                                        cmsspread2->gearing1() *
+                                            model_->swapRate(
+                                                arguments_.leg2FixingDates[j],
+                                                cmsspread2->swapIndex1()
+                                                    ->tenor(),
+                                                event0, zs[k],
+                                                cmsspread2->swapIndex1()) +
+                                        cmsspread2->gearing2() *
+                                            model_->swapRate(
+                                                arguments_.leg2FixingDates[j],
+                                                cmsspread2->swapIndex2()
+                                                    ->tenor(),
+                                                event0, zs[k],
+                                                cmsspread2->swapIndex2());
+                                Real rate =
+                                    arguments_.leg2Spreads[j] +
+                                    arguments_.leg2Gearings[j] * estFixings[k];
+                                if (arguments_.leg2CappedRates[j] !=
+                                    Null<Real>())
+                                    rate = std::min(
+                                        arguments_.leg2CappedRates[j], rate);
+                                if (arguments_.leg2FlooredRates[j] !=
+                                    Null<Real>())
+                                    rate = std::max(
+                                        arguments_.leg2FlooredRates[j], rate);
+                                amounts[k] = rate * arguments_.nominal2[j] *
+                                             arguments_.leg2AccrualTimes[j];
+                            }
+                        }
+
+                        Array discounts = model_->zerobond(
+                            arguments_.leg2PayDates[j], event0, zs,
+                            discountCurve_);
+                        for (Size k = 0; k < zs.size(); k++)
+                            underlyingFlows[k] +=
+                                amounts[k] * discounts[k] / numeraires[k] *
+                                zSpreadDf;
+
+                        if (j < arguments_.leg2FixingDates.size() - 1) {
+                            j++;
+                            done =
+                                (event0 != arguments_.leg2FixingDates[j]);
+                        } else
+                            done = true;
+
+                    } while (!done);
+                }
+
+                if (isExercise && rebatedExercise_ != nullptr) {
+                    Size j = std::find(arguments_.exercise->dates().begin(),
+                                       arguments_.exercise->dates().end(),
+                                       event0) -
+                             arguments_.exercise->dates().begin();
+                    Date rebateDate = rebatedExercise_->rebatePaymentDate(j);
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? Real(1.0)
+                            : std::exp(-oas_->value() *
+                                       (model_->termStructure()
+                                            ->dayCounter()
+                                            .yearFraction(event0,
+                                                          rebateDate)));
+                    rebateValue = rebatedExercise_->rebate(j) *
+                                  model_->zerobond(rebateDate, event0) *
+                                  zSpreadDf;
+                }
+            }
+
             // todo add openmp support later on (as in gaussian1dswaptionengine)
 
             for (Size k = 0; k < (event0 > expiry ? npv0.size() : 1); k++) {
@@ -425,196 +620,19 @@ namespace QuantLib {
 
                 if (isEventDate) {
 
-                    Real zk = event0 > expiry ? z[k] : y;
-
-                    if (isLeg1Fixing) { // if event is a fixing date and
-                                        // exercise date,
-                        // the coupon is part of the exercise into right (by
-                        // definition)
-                        Size j = std::find(arguments_.leg1FixingDates.begin(),
-                                           arguments_.leg1FixingDates.end(),
-                                           event0) -
-                                 arguments_.leg1FixingDates.begin();
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? Real(1.0)
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                event0,
-                                                arguments_.leg1PayDates[j])));
-                        bool done = false;
-                        do {
-                            Real amount;
-                            if (arguments_.leg1IsRedemptionFlow[j]) {
-                                amount = arguments_.leg1Coupons[j];
-                            } else {
-                                Real estFixing = 0.0;
-                                if (ibor1 != nullptr) {
-                                    estFixing = model_->forwardRate(
-                                        arguments_.leg1FixingDates[j], event0,
-                                        zk, ibor1);
-                                }
-                                if (cms1 != nullptr) {
-                                    estFixing = model_->swapRate(
-                                        arguments_.leg1FixingDates[j],
-                                        cms1->tenor(), event0, zk, cms1);
-                                }
-                                if (cmsspread1 != nullptr)
-                                    estFixing =
-                                        cmsspread1->gearing1() *
-                                            model_->swapRate(
-                                                arguments_.leg1FixingDates[j],
-                                                cmsspread1->swapIndex1()
-                                                    ->tenor(),
-                                                event0, zk,
-                                                cmsspread1->swapIndex1()) +
-                                        cmsspread1->gearing2() *
-                                            model_->swapRate(
-                                                arguments_.leg1FixingDates[j],
-                                                cmsspread1->swapIndex2()
-                                                    ->tenor(),
-                                                event0, zk,
-                                                cmsspread1->swapIndex2());
-                                Real rate =
-                                    arguments_.leg1Spreads[j] +
-                                    arguments_.leg1Gearings[j] * estFixing;
-                                if (arguments_.leg1CappedRates[j] !=
-                                    Null<Real>())
-                                    rate = std::min(
-                                        arguments_.leg1CappedRates[j], rate);
-                                if (arguments_.leg1FlooredRates[j] !=
-                                    Null<Real>())
-                                    rate = std::max(
-                                        arguments_.leg1FlooredRates[j], rate);
-                                amount = rate * arguments_.nominal1[j] *
-                                         arguments_.leg1AccrualTimes[j];
-                            }
-
-                            npv0a[k] -=
-                                amount *
-                                model_->zerobond(arguments_.leg1PayDates[j],
-                                                 event0, zk, discountCurve_) /
-                                model_->numeraire(event0Time, zk,
-                                                  discountCurve_) *
-                                zSpreadDf;
-
-                            if (j < arguments_.leg1FixingDates.size() - 1) {
-                                j++;
-                                done =
-                                    (event0 != arguments_.leg1FixingDates[j]);
-                            } else
-                                done = true;
-
-                        } while (!done);
-                    }
-
-                    if (isLeg2Fixing) { // if event is a fixing date and
-                                        // exercise date,
-                        // the coupon is part of the exercise into right (by
-                        // definition)
-                        Size j = std::find(arguments_.leg2FixingDates.begin(),
-                                           arguments_.leg2FixingDates.end(),
-                                           event0) -
-                                 arguments_.leg2FixingDates.begin();
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? Real(1.0)
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                event0,
-                                                arguments_.leg2PayDates[j])));
-                        bool done;
-                        do {
-                            Real amount;
-                            if (arguments_.leg2IsRedemptionFlow[j]) {
-                                amount = arguments_.leg2Coupons[j];
-                            } else {
-                                Real estFixing = 0.0;
-                                if (ibor2 != nullptr)
-                                    estFixing = model_->forwardRate(arguments_.leg2FixingDates[j],event0,zk,ibor2);
-                                if (cms2 != nullptr)
-                                    estFixing = model_->swapRate(arguments_.leg2FixingDates[j],cms2->tenor(),event0,zk,cms2);
-                                if (cmsspread2 != nullptr)
-                                    estFixing =
-                                        cmsspread2->gearing1() *
-                                            model_->swapRate(
-                                                arguments_.leg2FixingDates[j],
-                                                cmsspread2->swapIndex1()
-                                                    ->tenor(),
-                                                event0, zk,
-                                                cmsspread2->swapIndex1()) +
-                                        cmsspread2->gearing2() *
-                                            model_->swapRate(
-                                                arguments_.leg2FixingDates[j],
-                                                cmsspread2->swapIndex2()
-                                                    ->tenor(),
-                                                event0, zk,
-                                                cmsspread2->swapIndex2());
-                                Real rate =
-                                    arguments_.leg2Spreads[j] +
-                                    arguments_.leg2Gearings[j] * estFixing;
-                                if (arguments_.leg2CappedRates[j] !=
-                                    Null<Real>())
-                                    rate = std::min(
-                                        arguments_.leg2CappedRates[j], rate);
-                                if (arguments_.leg2FlooredRates[j] !=
-                                    Null<Real>())
-                                    rate = std::max(
-                                        arguments_.leg2FlooredRates[j], rate);
-                                amount = rate * arguments_.nominal2[j] *
-                                         arguments_.leg2AccrualTimes[j];
-                            }
-
-                            npv0a[k] +=
-                                amount *
-                                model_->zerobond(arguments_.leg2PayDates[j],
-                                                 event0, zk, discountCurve_) /
-                                model_->numeraire(event0Time, zk,
-                                                  discountCurve_) *
-                                zSpreadDf;
-                            if (j < arguments_.leg2FixingDates.size() - 1) {
-                                j++;
-                                done =
-                                    (event0 != arguments_.leg2FixingDates[j]);
-                            } else
-                                done = true;
-
-                        } while (!done);
-                    }
+                    npv0a[k] += underlyingFlows[k];
 
                     if (isExercise) {
-                        Size j = std::find(arguments_.exercise->dates().begin(),
-                                           arguments_.exercise->dates().end(),
-                                           event0) -
-                                 arguments_.exercise->dates().begin();
-                        Real rebate = 0.0;
-                        Real zSpreadDf = 1.0;
-                        Date rebateDate = event0;
-                        if (rebatedExercise_ != nullptr) {
-                            rebate = rebatedExercise_->rebate(j);
-                            rebateDate = rebatedExercise_->rebatePaymentDate(j);
-                            zSpreadDf =
-                                oas_.empty()
-                                    ? Real(1.0)
-                                    : std::exp(-oas_->value() *
-                                               (model_->termStructure()
-                                                    ->dayCounter()
-                                                    .yearFraction(event0,
-                                                                  rebateDate)));
-                        }
                         Real exerciseValue =
                             (type == Option::Call ? 1.0 : -1.0) * npv0a[k] +
-                            rebate * model_->zerobond(rebateDate, event0) *
-                                zSpreadDf / model_->numeraire(event0Time, zk,
-                                                              discountCurve_);
+                            rebateValue / numeraires[k];
 
                         if (considerProbabilities && probabilities_ != None) {
+                            Real numeraire =
+                                event0 > expiry
+                                    ? numeraires[k]
+                                    : model_->numeraire(event0Time, z[k],
+                                                        discountCurve_);
                             if (exIdx == noEx) {
                                 // if true we are at the latest date,
                                 // so we init
@@ -625,9 +643,7 @@ namespace QuantLib {
                                         : 1.0 / (model_->zerobond(
                                                      event0Time, 0.0, 0.0,
                                                      discountCurve_) *
-                                                 model_->numeraire(
-                                                     event0, z[k],
-                                                     discountCurve_));
+                                                 numeraire);
                             }
                             if (exerciseValue >= npv0[k]) {
                                 npvp0[exIdx-1][k] =
@@ -636,9 +652,7 @@ namespace QuantLib {
                                         : 1.0 / (model_->zerobond(
                                                      event0Time, 0.0, 0.0,
                                                      discountCurve_) *
-                                                 model_->numeraire(
-                                                     event0Time, z[k],
-                                                     discountCurve_));
+                                                 numeraire);
                                 for (Size ii = exIdx; ii < noEx+1; ++ii)
                                     npvp0[ii][k] = 0.0;
                             }
@@ -198,6 +198,87 @@ namespace QuantLib {
                                  arguments_.floatingResetDates.end(), expiry0 - 1) -
                 arguments_.floatingResetDates.begin();
 
+            // the exercise values are computed on the whole grid at
+            // once, so that the deterministic parts of the model
+            // quantities are evaluated a single time
+            Array exerciseValues, numeraires;
+            if (expiry0 > settlement) {
+                Array floatingLegNpv(z.size(), 0.0);
+                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? Real(1.0)
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(
+                                            expiry0,
+                                            arguments_.floatingPayDates[l])));
+                    Array discounts = model_->zerobond(
+                        arguments_.floatingPayDates[l], expiry0, z, discountCurve_);
+                    if (arguments_.floatingIsRedemptionFlow[l]) {
+                        for (Size k = 0; k < z.size(); k++)
+                            floatingLegNpv[k] += arguments_.floatingCoupons[l] *
+                                                 discounts[k] * zSpreadDf;
+                    } else {
+                        Array forwards = model_->forwardRate(
+                            arguments_.floatingFixingDates[l], expiry0, z,
+                            arguments_.swap->iborIndex());
+                        for (Size k = 0; k < z.size(); k++)
+                            floatingLegNpv[k] +=
+                                arguments_.floatingNominal[l] *
+                                arguments_.floatingAccrualTimes[l] *
+                                (arguments_.floatingGearings[l] * forwards[k] +
+                                 arguments_.floatingSpreads[l]) *
+                                discounts[k] * zSpreadDf;
+                    }
+                }
+                Array fixedLegNpv(z.size(), 0.0);
+                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? Real(1.0)
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(
+                                            expiry0,
+                                            arguments_.fixedPayDates[l])));
+                    Array discounts = model_->zerobond(
+                        arguments_.fixedPayDates[l], expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        fixedLegNpv[k] +=
+                            arguments_.fixedCoupons[l] * discounts[k] * zSpreadDf;
+                }
+                Real rebate = 0.0;
+                Real zSpreadDf = 1.0;
+                Date rebateDate = expiry0;
+                if (rebatedExercise != nullptr) {
+                    rebate = rebatedExercise->rebate(idx);
+                    rebateDate = rebatedExercise->rebatePaymentDate(idx);
+                    zSpreadDf =
+                        oas_.empty()
+                            ? Real(1.0)
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(expiry0, rebateDate)));
+                }
+                Array rebateDiscounts =
+                    model_->zerobond(rebateDate, expiry0, z, discountCurve_);
+                numeraires = model_->numeraire(expiry0Time, z, discountCurve_);
+                exerciseValues = Array(z.size());
+                for (Size k = 0; k < z.size(); k++)
+                    exerciseValues[k] =
+                        ((type == Option::Call ? 1.0 : -1.0) *
+                             (floatingLegNpv[k] - fixedLegNpv[k]) +
+                         rebate * rebateDiscounts[k] * zSpreadDf) /
+                        numeraires[k];
+            }
+
             // todo add openmp support later on (as in gaussian1dswaptionengine)
 
             for (Size k = 0; k < (expiry0 > settlement ? npv0.size() : 1);
@@ -356,78 +437,7 @@ namespace QuantLib {
                 // end probability computation
 
                 if (expiry0 > settlement) {
-                    Real floatingLegNpv = 0.0;
-                    for (Size l = k1; l < arguments_.floatingCoupons.size();
-                         l++) {
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? Real(1.0)
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                expiry0,
-                                                arguments_
-                                                    .floatingPayDates[l])));
-                        Real amount;
-                        if (arguments_.floatingIsRedemptionFlow[l])
-                            amount = arguments_.floatingCoupons[l];
-                        else
-                            amount = arguments_.floatingNominal[l] *
-                                     arguments_.floatingAccrualTimes[l] *
-                                     (arguments_.floatingGearings[l] *
-                                          model_->forwardRate(
-                                              arguments_.floatingFixingDates[l],
-                                              expiry0, z[k],
-                                              arguments_.swap->iborIndex()) +
-                                      arguments_.floatingSpreads[l]);
-                        floatingLegNpv +=
-                            amount *
-                            model_->zerobond(arguments_.floatingPayDates[l],
-                                             expiry0, z[k], discountCurve_) *
-                            zSpreadDf;
-                    }
-                    Real fixedLegNpv = 0.0;
-                    for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? Real(1.0)
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                expiry0,
-                                                arguments_.fixedPayDates[l])));
-                        fixedLegNpv +=
-                            arguments_.fixedCoupons[l] *
-                            model_->zerobond(arguments_.fixedPayDates[l],
-                                             expiry0, z[k], discountCurve_) *
-                            zSpreadDf;
-                    }
-                    Real rebate = 0.0;
-                    Real zSpreadDf = 1.0;
-                    Date rebateDate = expiry0;
-                    if (rebatedExercise != nullptr) {
-                        rebate = rebatedExercise->rebate(idx);
-                        rebateDate = rebatedExercise->rebatePaymentDate(idx);
-                        zSpreadDf =
-                            oas_.empty()
-                                ? Real(1.0)
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(expiry0, rebateDate)));
-                    }
-                    Real exerciseValue =
-                        ((type == Option::Call ? 1.0 : -1.0) *
-                             (floatingLegNpv - fixedLegNpv) +
-                         rebate * model_->zerobond(rebateDate, expiry0, z[k],
-                                                   discountCurve_) *
-                             zSpreadDf) /
-                        model_->numeraire(expiry0Time, z[k], discountCurve_);
+                    Real exerciseValue = exerciseValues[k];
 
                     // for probability computation
                     if (probabilities_ != None) {
@@ -442,8 +452,7 @@ namespace QuantLib {
                                     : 1.0 / (model_->zerobond(expiry0Time, 0.0,
                                                               0.0,
                                                               discountCurve_) *
-                                             model_->numeraire(expiry0, z[k],
-                                                               discountCurve_));
+                                             numeraires[k]);
                         if (exerciseValue >= npv0[k]) {
                             npvp0[idx - minIdxAlive][k] =
                                 probabilities_ == Naive
@@ -452,8 +461,7 @@ namespace QuantLib {
                                           (model_->zerobond(expiry0Time, 0.0,
                                                             0.0,
                                                             discountCurve_) *
-                                           model_->numeraire(expiry0Time, z[k],
-                                                             discountCurve_));
+                                           numeraires[k]);
                             for (Size ii = idx - minIdxAlive + 1;
                                  ii < npvp0.size(); ii++)
                                 npvp0[ii][k] = 0.0;
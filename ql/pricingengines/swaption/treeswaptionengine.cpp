@@ -95,4 +95,113 @@ namespace QuantLib {
         results_.value = swaption.presentValue();
     }
 
+
+    namespace {
+
+        class JointSwaptionValuation {
+          public:
+            JointSwaptionValuation(
+                const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+                const ext::shared_ptr<ShortRateModel>& model,
+                const Handle<YieldTermStructure>& termStructure) {
+                Date referenceDate;
+                DayCounter dayCounter;
+                auto tsmodel =
+                    ext::dynamic_pointer_cast<TermStructureConsistentModel>(model);
+                if (tsmodel != nullptr) {
+                    referenceDate = tsmodel->termStructure()->referenceDate();
+                    dayCounter = tsmodel->termStructure()->dayCounter();
+                } else {
+                    QL_REQUIRE(!termStructure.empty(), "no term structure given");
+                    referenceDate = termStructure->referenceDate();
+                    dayCounter = termStructure->dayCounter();
+                }
+
+                for (const auto& s : swaptions) {
+                    Swaption::arguments arguments;
+                    s->setupArguments(&arguments);
+                    arguments.validate();
+                    QL_REQUIRE(arguments.settlementMethod != Settlement::ParYieldCurve,
+                               "cash settled (ParYieldCurve) swaptions not priced "
+                               "on trees");
+                    assets_.push_back(ext::make_shared<DiscretizedSwaption>(
+                        arguments, referenceDate, dayCounter));
+
+                    std::vector<Time> stoppingTimes;
+                    for (const auto& d : arguments.exercise->dates())
+                        stoppingTimes.push_back(
+                            dayCounter.yearFraction(referenceDate, d));
+                    auto next = std::find_if(stoppingTimes.begin(), stoppingTimes.end(),
+                                             [](Time t){ return t >= 0.0; });
+                    QL_REQUIRE(next != stoppingTimes.end(),
+                               "swaption has no future exercise date");
+                    startTimes_.push_back(stoppingTimes.back());
+                    nextExercises_.push_back(*next);
+                }
+            }
+
+            std::vector<Time> mandatoryTimes() const {
+                std::vector<Time> times;
+                for (const auto& asset : assets_) {
+                    std::vector<Time> t = asset->mandatoryTimes();
+                    times.insert(times.end(), t.begin(), t.end());
+                }
+                return times;
+            }
+
+            std::vector<Real> values(const ext::shared_ptr<Lattice>& lattice) {
+                std::vector<DiscretizedAsset*> assets;
+                for (Size i=0; i<assets_.size(); ++i) {
+                    assets_[i]->initialize(lattice, startTimes_[i]);
+                    assets.push_back(assets_[i].get());
+                }
+                if (assets.empty())
+                    return {};
+                // The underlying swaps are rolled back in the same
+                // group.  Being adjusted after the swaptions, they are
+                // already at the right time when each swaption adjusts
+                // and exercises, so that the partial rollbacks the
+                // swaptions perform on them do nothing.
+                for (const auto& asset : assets_)
+                    assets.push_back(asset->underlying().get());
+
+                // rolling back further than the next exercise only
+                // discounts, which doesn't change the present value
+                Time to = *std::min_element(nextExercises_.begin(),
+                                            nextExercises_.end());
+                lattice->jointRollback(assets, to);
+
+                std::vector<Real> results;
+                for (const auto& asset : assets_)
+                    results.push_back(asset->presentValue());
+                return results;
+            }
+
+          private:
+            std::vector<ext::shared_ptr<DiscretizedSwaption> > assets_;
+            std::vector<Time> startTimes_, nextExercises_;
+        };
+
+    }
+
+    std::vector<Real> treeSwaptionValues(
+        const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+        const ext::shared_ptr<ShortRateModel>& model,
+        Size timeSteps,
+        const Handle<YieldTermStructure>& termStructure) {
+        JointSwaptionValuation valuation(swaptions, model, termStructure);
+        std::vector<Time> times = valuation.mandatoryTimes();
+        TimeGrid timeGrid(times.begin(), times.end(), timeSteps);
+        return valuation.values(model->tree(timeGrid));
+    }
+
+    std::vector<Real> treeSwaptionValues(
+        const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+        const ext::shared_ptr<ShortRateModel>& model,
+        const TimeGrid& timeGrid,
+        const Handle<YieldTermStructure>& termStructure) {
+        JointSwaptionValuation valuation(swaptions, model, termStructure);
+        return valuation.values(model->tree(timeGrid));
+    }
+
 }
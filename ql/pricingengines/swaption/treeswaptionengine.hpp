@@ -66,6 +66,34 @@ namespace QuantLib {
         Handle<YieldTermStructure> termStructure_;
     };
 
+    /*! \name Joint valuation of swaptions on a tree
+
+        The swaptions are rolled back together on a single tree built
+        by the given model, together with their underlying swaps, so
+        that the lattice work at each node is shared between them.
+        Each value is the one that TreeSwaptionEngine would return on
+        the same tree.
+
+        \note the term structure is only needed when the short-rate
+              model cannot provide one itself.
+
+        @{
+    */
+    /*! The time grid contains the mandatory times of all the
+        swaptions and the given number of steps. */
+    std::vector<Real> treeSwaptionValues(
+        const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+        const ext::shared_ptr<ShortRateModel>& model,
+        Size timeSteps,
+        const Handle<YieldTermStructure>& termStructure = Handle<YieldTermStructure>());
+
+    std::vector<Real> treeSwaptionValues(
+        const std::vector<ext::shared_ptr<Swaption> >& swaptions,
+        const ext::shared_ptr<ShortRateModel>& model,
+        const TimeGrid& timeGrid,
+        const Handle<YieldTermStructure>& termStructure = Handle<YieldTermStructure>());
+    //@}
+
 }
 
 
@@ -41,6 +41,7 @@
 #include <functional>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <utility>
 
 #if defined(QL_PATCH_MSVC)
@@ -504,7 +505,7 @@ namespace QuantLib {
         }
     }
 
-    Real AnalyticHestonEngine::AP_Helper::operator()(Real u) const {
+    std::complex<Real> AnalyticHestonEngine::AP_Helper::kernel(Real u) const {
         QL_REQUIRE(   enginePtr_->addOnTerm(u, term_, 1)
                         == std::complex<Real>(0.0)
                    && enginePtr_->addOnTerm(u, term_, 2)
@@ -525,11 +526,8 @@ namespace QuantLib {
             else if (cpxLog_ == AsymptoticChF)
                 phiBS = std::exp(u*std::complex<Real>(1, tanPhi_)*phi_ + psi_);
 
-            return std::exp(-u*tanPhi_*freq_)
-                    *(std::exp(std::complex<Real>(0.0, u*freq_))
-                      *std::complex<Real>(1, tanPhi_)
-                      *(phiBS - enginePtr_->chF(hPrime, term_))/(h_u*hPrime)
-                      ).real()*s_alpha_;
+            return std::complex<Real>(1, tanPhi_)
+                *(phiBS - enginePtr_->chF(hPrime, term_))/(h_u*hPrime);
         }
         else if (cpxLog_ == AndersenPiterbarg || cpxLog_ == AndersenPiterbargOptCV) {
             const std::complex<Real> z(u, -alpha_);
@@ -539,14 +537,24 @@ namespace QuantLib {
                         std::complex<Real>(-zPrime.imag(), zPrime.real()))
             );
 
-            return (std::exp(std::complex<Real> (0.0, u*freq_))
-                * (phiBS - enginePtr_->chF(zPrime, term_)) / (z*zPrime)
-                ).real()*s_alpha_;
+            return (phiBS - enginePtr_->chF(zPrime, term_)) / (z*zPrime);
         }
         else
             QL_FAIL("unknown control variate");
     }
 
+    Real AnalyticHestonEngine::AP_Helper::operator()(
+        Real u, const std::complex<Real>& kernel) const {
+        // tanPhi_ is zero for the Andersen-Piterbarg control variates
+        return std::exp(-u*tanPhi_*freq_)
+            *(std::exp(std::complex<Real>(0.0, u*freq_))*kernel).real()
+            *s_alpha_;
+    }
+
+    Real AnalyticHestonEngine::AP_Helper::operator()(Real u) const {
+        return (*this)(u, kernel(u));
+    }
+
     Real AnalyticHestonEngine::AP_Helper::controlVariateValue() const {
         if (   cpxLog_ == AngledContour
             || cpxLog_ == AndersenPiterbarg || cpxLog_ == AndersenPiterbargOptCV) {
@@ -858,6 +866,127 @@ namespace QuantLib {
         return value;
     }
 
+    std::vector<Real> AnalyticHestonEngine::priceVanillaPayoffs(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        const Date& maturity) const {
+
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+        const Real fwd = process->s0()->value()
+             * process->dividendYield()->discount(maturity)
+             / process->riskFreeRate()->discount(maturity);
+
+        return priceVanillaPayoffs(payoffs, process->time(maturity), fwd);
+    }
+
+    std::vector<Real> AnalyticHestonEngine::priceVanillaPayoffs(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        Time maturity) const {
+
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+        const Real fwd = process->s0()->value()
+             * process->dividendYield()->discount(maturity)
+             / process->riskFreeRate()->discount(maturity);
+
+        return priceVanillaPayoffs(payoffs, maturity, fwd);
+    }
+
+    std::vector<Real> AnalyticHestonEngine::priceVanillaPayoffs(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        Time maturity, Real fwd) const {
+
+        std::vector<Real> values;
+        values.reserve(payoffs.size());
+
+        if (cpxLog_ == Gatheral || cpxLog_ == BranchCorrection) {
+            // the integrands of these formulas are evaluated one by one
+            Size evaluations = 0;
+            for (const auto& payoff : payoffs) {
+                values.push_back(priceVanillaPayoff(payoff, maturity, fwd));
+                evaluations += evaluations_;
+            }
+            evaluations_ = evaluations;
+            return values;
+        }
+
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+        const DiscountFactor dr = process->riskFreeRate()->discount(maturity);
+        QL_REQUIRE(process->s0()->value() > 0.0,
+                   "negative or null underlying given");
+
+        const Real kappa = model_->kappa();
+        const Real sigma = model_->sigma();
+        const Real theta = model_->theta();
+        const Real rho   = model_->rho();
+        const Real v0    = model_->v0();
+
+        const Real c_inf =
+            std::sqrt(1.0-rho*rho)*(v0 + kappa*theta*maturity)/sigma;
+
+        const ComplexLogFormula finalLog = (cpxLog_ == OptimalCV)
+            ? optimalControlVariate(maturity, v0, kappa, theta, sigma, rho)
+            : cpxLog_;
+
+        const Real vAvg = (1-std::exp(-kappa*maturity))*(v0-theta)/(kappa*maturity) + theta;
+
+        const Real scalingFactor = (cpxLog_ != OptimalCV && cpxLog_ != AsymptoticChF)
+            ? std::max(0.25, std::min(1000.0, 0.25/std::sqrt(0.5*vAvg*maturity)))
+            : Real(1.0);
+
+        // kernels evaluated so far, in the order in which the
+        // integration algorithm requested them; one list per contour
+        std::map<Real, std::vector<std::pair<Real, std::complex<Real> > > > kernels;
+
+        evaluations_ = 0;
+
+        for (const auto& payoff : payoffs) {
+            const Real strike = payoff->strike();
+
+            const Real epsilon = andersenPiterbargEpsilon_
+                *M_PI/(std::sqrt(strike*fwd)*dr);
+
+            const std::function<Real()> uM = [&](){
+                return Integration::andersenPiterbargIntegrationLimit(
+                    c_inf, epsilon, v0, maturity);
+            };
+
+            const AP_Helper cvHelper(
+                 maturity, fwd, strike, finalLog, this, alpha_
+            );
+
+            auto& cache = kernels[cvHelper.contourSlope()];
+            Size n = 0;
+            const auto integrand = [&](Real u) -> Real {
+                if (n == cache.size()) {
+                    cache.emplace_back(u, cvHelper.kernel(u));
+                    ++evaluations_;
+                } else if (cache[n].first != u) {
+                    cache[n] = std::make_pair(u, cvHelper.kernel(u));
+                    ++evaluations_;
+                }
+                return cvHelper(u, cache[n++].second);
+            };
+
+            const Real h_cv = fwd/M_PI
+                *integration_->calculate(c_inf, integrand, uM, scalingFactor);
+
+            const Real cvValue = cvHelper.controlVariateValue();
+
+            switch (payoff->optionType())
+            {
+              case Option::Call:
+                values.push_back((cvValue + h_cv)*dr);
+                break;
+              case Option::Put:
+                values.push_back((cvValue + h_cv - (fwd - strike))*dr);
+                break;
+              default:
+                QL_FAIL("unknown option type");
+            }
+        }
+
+        return values;
+    }
+
     void AnalyticHestonEngine::calculate() const
     {
         // this is a european option pricer
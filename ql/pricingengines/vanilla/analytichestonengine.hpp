@@ -33,6 +33,7 @@
 #include <ql/instruments/vanillaoption.hpp>
 #include <functional>
 #include <complex>
+#include <vector>
 
 namespace QuantLib {
 
@@ -170,6 +171,18 @@ namespace QuantLib {
         Real priceVanillaPayoff(
            const ext::shared_ptr<PlainVanillaPayoff>& payoff, Time maturity) const;
 
+        // prices a chain of payoffs with the same maturity. The
+        // characteristic function does not depend on the strike, so
+        // its values on the integration nodes are computed once and
+        // reused for all payoffs whenever the nodes coincide.
+        std::vector<Real> priceVanillaPayoffs(
+           const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+           const Date& maturity) const;
+
+        std::vector<Real> priceVanillaPayoffs(
+           const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+           Time maturity) const;
+
         static ComplexLogFormula optimalControlVariate(
              Time t, Real v0, Real kappa, Real theta, Real sigma, Real rho);
 
@@ -187,6 +200,10 @@ namespace QuantLib {
            const ext::shared_ptr<PlainVanillaPayoff>& payoff,
            Time maturity, Real fwd) const;
 
+        std::vector<Real> priceVanillaPayoffs(
+           const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+           Time maturity, Real fwd) const;
+
 
         mutable Size evaluations_;
         const ComplexLogFormula cpxLog_;
@@ -264,13 +281,22 @@ namespace QuantLib {
         Real operator()(Real u) const;
         Real controlVariateValue() const;
 
+        // the integrand is Re(exp(i u log(F/K)) kernel(u)) up to
+        // factors depending on u and the strike only. The kernel holds
+        // the characteristic function; it does not depend on the
+        // strike and is the same for all helpers with equal term and
+        // contour.
+        std::complex<Real> kernel(Real u) const;
+        Real operator()(Real u, const std::complex<Real>& kernel) const;
+        Real contourSlope() const { return tanPhi_; }
+
       private:
         const Time term_;
         const Real fwd_, strike_, freq_;
         const ComplexLogFormula cpxLog_;
         const AnalyticHestonEngine* const enginePtr_;
         const Real alpha_, s_alpha_;
-        Real vAvg_, tanPhi_;
+        Real vAvg_, tanPhi_ = 0.0;
         std::complex<Real> phi_, psi_;
     };
 
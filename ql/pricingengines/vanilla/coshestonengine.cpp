@@ -60,9 +60,16 @@ namespace QuantLib {
             ext::dynamic_pointer_cast<PlainVanillaPayoff>(arguments_.payoff);
         QL_REQUIRE(payoff, "non plain vanilla payoff given");
 
+        results_.value =
+            priceVanillaPayoffs({payoff}, arguments_.exercise->lastDate())[0];
+    }
+
+    std::vector<Real> COSHestonEngine::priceVanillaPayoffs(
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+        const Date& maturityDate) const {
+
         const ext::shared_ptr<HestonProcess> process = model_->process();
 
-        const Date maturityDate = arguments_.exercise->lastDate();
         const Time maturity = process->time(maturityDate);
 
         const Real cum1 = c1(maturity);
@@ -71,7 +78,6 @@ namespace QuantLib {
             // + std::sqrt(std::fabs(c4(maturity)))
         );
 
-        const Real k = payoff->strike();
         const Real spot = process->s0()->value();
         QL_REQUIRE(spot > 0.0, "negative or null underlying given");
 
@@ -80,48 +86,65 @@ namespace QuantLib {
         const DiscountFactor qf
             = process->dividendYield()->discount(maturityDate);
         const Real fwd = spot*qf/df;
-        const Real x = std::log(fwd/k);
-
-        const Real a = x + cum1 - L_*w;
-        const Real b = x + cum1 + L_*w;
-        
-        // Check if it exceeds the truncation bound
-        
-        if (x >= b/2 || x <= a/2) {
-            //returns lower/upper bounds
-            if (payoff->optionType() == Option::Put)
-                results_.value = std::max(-spot*qf+k*df,0.0);
-            else if (payoff->optionType() == Option::Call)
-           	    results_.value = std::max(spot*qf-k*df,0.0);
-       	    else
-                QL_FAIL("unknown payoff type");
-            return;
-        }
-		
-
-        const Real d = 1.0/(b-a);
 
-        const Real expA = std::exp(a);
-        Real s = chF(0, maturity).real()*(expA-1-a)*d;
+        // the width b-a of the truncation range and therefore the
+        // frequencies do not depend on the strike, and neither does
+        // x-a = L*w-cum1, so that the characteristic function terms
+        // are shared by all payoffs
+        const Real d = 1.0/(2.0*L_*w);
+        const Real xa = L_*w - cum1;
 
+        std::vector<Real> chFTerms(N_);
+        chFTerms[0] = chF(0, maturity).real();
         for (Size n=1; n < N_; ++n) {
             const Real r = n*M_PI*d;
-            const Real U_n = 2.0*d*( 1.0/(1.0 + r*r)
-                *(expA + r*std::sin(r*a) - std::cos(r*a)) - 1.0/r*std::sin(r*a));
-
-            s += U_n*(chF(r, maturity)
-                     *std::exp(std::complex<Real>(0, r*(x-a)))).real();
+            chFTerms[n] = (chF(r, maturity)
+                           *std::exp(std::complex<Real>(0, r*xa))).real();
         }
 
-        if (payoff->optionType() == Option::Put)
-            results_.value = k*df*s;
-        else if (payoff->optionType() == Option::Call) {
-            const DiscountFactor qf
-                = process->dividendYield()->discount(maturityDate);
-            results_.value = spot*qf - k*df*(1-s);
+        std::vector<Real> values;
+        values.reserve(payoffs.size());
+
+        for (const auto& payoff : payoffs) {
+            const Real k = payoff->strike();
+            const Real x = std::log(fwd/k);
+
+            const Real a = x + cum1 - L_*w;
+            const Real b = x + cum1 + L_*w;
+
+            // Check if it exceeds the truncation bound
+
+            if (x >= b/2 || x <= a/2) {
+                //returns lower/upper bounds
+                if (payoff->optionType() == Option::Put)
+                    values.push_back(std::max(-spot*qf+k*df,0.0));
+                else if (payoff->optionType() == Option::Call)
+                    values.push_back(std::max(spot*qf-k*df,0.0));
+                else
+                    QL_FAIL("unknown payoff type");
+                continue;
+            }
+
+            const Real expA = std::exp(a);
+            Real s = chFTerms[0]*(expA-1-a)*d;
+
+            for (Size n=1; n < N_; ++n) {
+                const Real r = n*M_PI*d;
+                const Real U_n = 2.0*d*( 1.0/(1.0 + r*r)
+                    *(expA + r*std::sin(r*a) - std::cos(r*a)) - 1.0/r*std::sin(r*a));
+
+                s += U_n*chFTerms[n];
+            }
+
+            if (payoff->optionType() == Option::Put)
+                values.push_back(k*df*s);
+            else if (payoff->optionType() == Option::Call)
+                values.push_back(spot*qf - k*df*(1-s));
+            else
+                QL_FAIL("unknown payoff type");
         }
-        else
-            QL_FAIL("unknown payoff type");
+
+        return values;
     }
 
     Real COSHestonEngine::muT(Time t) const {
@@ -25,10 +25,12 @@
 #define quantlib_cos_heston_engine_hpp
 
 #include <ql/models/equity/hestonmodel.hpp>
+#include <ql/instruments/payoffs.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 #include <ql/pricingengines/genericmodelengine.hpp>
 
 #include <complex>
+#include <vector>
 
 namespace QuantLib {
 
@@ -61,6 +63,12 @@ namespace QuantLib {
         void update() override;
         void calculate() const override;
 
+        // prices a chain of payoffs with the same maturity; the
+        // characteristic function is evaluated once for all of them
+        std::vector<Real> priceVanillaPayoffs(
+            const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs,
+            const Date& maturityDate) const;
+
         // normalized characteristic function
         std::complex<Real> chF(Real u, Real t) const;
 
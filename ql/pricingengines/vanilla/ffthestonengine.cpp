@@ -0,0 +1,103 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/pricingengines/vanilla/ffthestonengine.hpp>
+#include <utility>
+
+namespace QuantLib {
+
+    FFTHestonEngine::FFTHestonEngine(const ext::shared_ptr<HestonModel>& model,
+                                     Real logStrikeSpacing)
+    : FFTHestonEngine(model, logStrikeSpacing,
+                      ext::make_shared<AnalyticHestonEngine>(model)) {}
+
+    FFTHestonEngine::FFTHestonEngine(const ext::shared_ptr<HestonModel>& model,
+                                     Real logStrikeSpacing,
+                                     ext::shared_ptr<AnalyticHestonEngine> hestonEngine)
+    : FFTEngine(logStrikeSpacing), model_(model),
+      hestonEngine_(std::move(hestonEngine)) {
+        registerWith(model_);
+    }
+
+    std::unique_ptr<FFTEngine> FFTHestonEngine::clone() const {
+        return std::unique_ptr<FFTEngine>(
+            new FFTHestonEngine(model_, lambda_, hestonEngine_));
+    }
+
+    void FFTHestonEngine::precalculateExpiry(Date d) {
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+        t_ = process->time(d);
+        logForward_ = std::log(process->s0()->value()
+                               * process->dividendYield()->discount(d)
+                               / process->riskFreeRate()->discount(d));
+    }
+
+    std::complex<Real> FFTHestonEngine::complexFourierTransform(
+                                                std::complex<Real> u) const {
+        const std::complex<Real> i1(0, 1);
+        return hestonEngine_->chF(u, t_)
+            * std::exp(i1 * u * logForward_ + jumpTerm(u, t_));
+    }
+
+    Real FFTHestonEngine::discountFactor(Date d) const {
+        return model_->process()->riskFreeRate()->discount(d);
+    }
+
+    Real FFTHestonEngine::dividendYield(Date d) const {
+        return model_->process()->dividendYield()->discount(d);
+    }
+
+    Real FFTHestonEngine::underlyingValue() const {
+        return model_->process()->s0()->value();
+    }
+
+    std::complex<Real> FFTHestonEngine::jumpTerm(const std::complex<Real>&,
+                                                 Time) const {
+        return {0.0, 0.0};
+    }
+
+
+    FFTBatesEngine::FFTBatesEngine(const ext::shared_ptr<BatesModel>& model,
+                                   Real logStrikeSpacing)
+    : FFTHestonEngine(model, logStrikeSpacing) {}
+
+    FFTBatesEngine::FFTBatesEngine(const ext::shared_ptr<BatesModel>& model,
+                                   Real logStrikeSpacing,
+                                   ext::shared_ptr<AnalyticHestonEngine> hestonEngine)
+    : FFTHestonEngine(model, logStrikeSpacing, std::move(hestonEngine)) {}
+
+    std::unique_ptr<FFTEngine> FFTBatesEngine::clone() const {
+        return std::unique_ptr<FFTEngine>(new FFTBatesEngine(
+            ext::dynamic_pointer_cast<BatesModel>(model_), lambda_, hestonEngine_));
+    }
+
+    std::complex<Real> FFTBatesEngine::jumpTerm(const std::complex<Real>& u,
+                                                Time t) const {
+        const ext::shared_ptr<BatesModel> batesModel =
+            ext::dynamic_pointer_cast<BatesModel>(model_);
+
+        const Real nu     = batesModel->nu();
+        const Real delta2 = 0.5*batesModel->delta()*batesModel->delta();
+        const Real lambda = batesModel->lambda();
+        const std::complex<Real> g = std::complex<Real>(0, 1)*u;
+
+        // compensated log-normal jumps, see BatesEngine::addOnTerm
+        return t*lambda*(std::exp(nu*g + delta2*g*g) - 1.0
+                         - g*(std::exp(nu + delta2) - 1.0));
+    }
+
+}
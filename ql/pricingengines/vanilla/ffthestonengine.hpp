@@ -0,0 +1,99 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <https://www.quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file ffthestonengine.hpp
+    \brief FFT engines for vanilla options under the Heston and Bates models
+*/
+
+#ifndef quantlib_fft_heston_engine_hpp
+#define quantlib_fft_heston_engine_hpp
+
+#include <ql/models/equity/batesmodel.hpp>
+#include <ql/pricingengines/vanilla/analytichestonengine.hpp>
+#include <ql/pricingengines/vanilla/fftengine.hpp>
+
+namespace QuantLib {
+
+    //! FFT pricing engine for vanilla options under the Heston model
+    /*! The characteristic function is the one used by the
+        AnalyticHestonEngine; all options with the same expiry are
+        priced by a single Carr-Madan transform.  This is most useful
+        when a whole surface is priced at once, e.g., during a
+        calibration, since the call prices computed for an expiry are
+        reused by all the options expiring on the same date until the
+        model changes.
+
+        \ingroup vanillaengines
+
+        \test the correctness of the returned values is tested by
+              comparison with the analytic Heston engine.
+    */
+    class FFTHestonEngine : public FFTEngine {
+      public:
+        explicit FFTHestonEngine(const ext::shared_ptr<HestonModel>& model,
+                                 Real logStrikeSpacing = 0.001);
+        std::unique_ptr<FFTEngine> clone() const override;
+
+      protected:
+        void precalculateExpiry(Date d) override;
+        std::complex<Real> complexFourierTransform(std::complex<Real> u) const override;
+        Real discountFactor(Date d) const override;
+        Real dividendYield(Date d) const override;
+        Real underlyingValue() const override;
+
+        //! logarithm of the characteristic function of additional jumps
+        virtual std::complex<Real> jumpTerm(const std::complex<Real>& u, Time t) const;
+
+        // used by clones, which share the characteristic function
+        FFTHestonEngine(const ext::shared_ptr<HestonModel>& model,
+                        Real logStrikeSpacing,
+                        ext::shared_ptr<AnalyticHestonEngine> hestonEngine);
+
+        ext::shared_ptr<HestonModel> model_;
+        // provides the normalized characteristic function
+        ext::shared_ptr<AnalyticHestonEngine> hestonEngine_;
+
+      private:
+        Time t_ = 0.0;
+        Real logForward_ = 0.0;
+    };
+
+
+    //! FFT pricing engine for vanilla options under the Bates model
+    /*! \ingroup vanillaengines
+
+        \test the correctness of the returned values is tested by
+              comparison with the analytic Bates engine.
+    */
+    class FFTBatesEngine : public FFTHestonEngine {
+      public:
+        explicit FFTBatesEngine(const ext::shared_ptr<BatesModel>& model,
+                                Real logStrikeSpacing = 0.001);
+        std::unique_ptr<FFTEngine> clone() const override;
+
+      protected:
+        std::complex<Real> jumpTerm(const std::complex<Real>& u, Time t) const override;
+
+      private:
+        FFTBatesEngine(const ext::shared_ptr<BatesModel>& model,
+                       Real logStrikeSpacing,
+                       ext::shared_ptr<AnalyticHestonEngine> hestonEngine);
+    };
+
+}
+
+#endif
@@ -20,6 +20,8 @@
 #include <ql/termstructures/volatility/equityfx/andreasenhugelocalvoladapter.hpp>
 #include <ql/termstructures/volatility/equityfx/andreasenhugevolatilityinterpl.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 namespace QuantLib {
@@ -29,6 +31,44 @@ namespace QuantLib {
         ext::shared_ptr<AndreasenHugeVolatilityInterpl> localVol)
     : localVol_(std::move(localVol)) {}
 
+    AndreasenHugeLocalVolAdapter::AndreasenHugeLocalVolAdapter(
+        ext::shared_ptr<AndreasenHugeVolatilityInterpl> localVol,
+        std::vector<Time> gridTimes,
+        Size nStrikes)
+    : localVol_(std::move(localVol)), gridTimes_(std::move(gridTimes)),
+      nGridStrikes_(nStrikes) {
+        QL_REQUIRE(!gridTimes_.empty(), "no grid times given");
+        QL_REQUIRE(std::is_sorted(gridTimes_.begin(), gridTimes_.end()),
+                   "grid times must be sorted");
+        QL_REQUIRE(nGridStrikes_ > 1, "at least two grid strikes required");
+
+        registerWith(localVol_);
+    }
+
+    void AndreasenHugeLocalVolAdapter::update() {
+        // the grid is rebuilt on the next lookup; rebuilding it here
+        // would recalibrate the interpolation on every notification
+        gridUpToDate_ = false;
+        LocalVolTermStructure::update();
+    }
+
+    void AndreasenHugeLocalVolAdapter::buildGrid() const {
+        const Real lnMinStrike = std::log(localVol_->minStrike());
+        const Real dLnStrike = (std::log(localVol_->maxStrike()) - lnMinStrike)
+            / (nGridStrikes_ - 1);
+
+        Matrix gridVols(gridTimes_.size(), nGridStrikes_);
+        for (Size i=0; i < gridTimes_.size(); ++i)
+            for (Size j=0; j < nGridStrikes_; ++j)
+                gridVols[i][j] = localVol_->localVol(
+                    gridTimes_[i], std::exp(lnMinStrike + j*dLnStrike));
+
+        lnMinStrike_ = lnMinStrike;
+        dLnStrike_ = dLnStrike;
+        gridVols_.swap(gridVols);
+        gridUpToDate_ = true;
+    }
+
     Date AndreasenHugeLocalVolAdapter::maxDate() const {
         return localVol_->maxDate();
     }
@@ -43,9 +83,33 @@ namespace QuantLib {
 
     Volatility
     AndreasenHugeLocalVolAdapter::localVolImpl(Time t, Real strike) const {
-        return localVol_->localVol(t,
-            std::min(localVol_->maxStrike(),
-                std::max(localVol_->minStrike(), strike)));
+        const Real k = std::min(localVol_->maxStrike(),
+                                std::max(localVol_->minStrike(), strike));
+        if (gridTimes_.empty())
+            return localVol_->localVol(t, k);
+
+        if (!gridUpToDate_) {
+            std::lock_guard<std::mutex> lock(gridMutex_);
+            if (!gridUpToDate_)
+                buildGrid();
+        }
+
+        const Real x = (std::log(k) - lnMinStrike_)/dLnStrike_;
+        const Size j = std::min<Size>(Size(std::max(x, 0.0)), nGridStrikes_-2);
+        const Real w = x - j;
+        const auto vol = [&](Size i) {
+            return (1.0-w)*gridVols_[i][j] + w*gridVols_[i][j+1];
+        };
+
+        const Size i = std::upper_bound(gridTimes_.begin(), gridTimes_.end(), t)
+            - gridTimes_.begin();
+        if (i == 0)
+            return vol(0);
+        else if (i == gridTimes_.size())
+            return vol(i-1);
+
+        const Real u = (t - gridTimes_[i-1])/(gridTimes_[i] - gridTimes_[i-1]);
+        return (1.0-u)*vol(i-1) + u*vol(i);
     }
 
     Calendar AndreasenHugeLocalVolAdapter::calendar() const {
@@ -25,7 +25,11 @@
 #ifndef quantlib_andreasen_huge_local_volatility_adapter_hpp
 #define quantlib_andreasen_huge_local_volatility_adapter_hpp
 
+#include <ql/math/matrix.hpp>
 #include <ql/termstructures/volatility/equityfx/localvoltermstructure.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace QuantLib {
 
@@ -35,6 +39,23 @@ namespace QuantLib {
       public:
         explicit AndreasenHugeLocalVolAdapter(
             ext::shared_ptr<AndreasenHugeVolatilityInterpl> localVol);
+        /*! The local volatility is precomputed at the given times and
+            on nStrikes strikes equally spaced in log-strike between
+            the minimum and maximum strike of the interpolation; it is
+            then interpolated linearly in log-strike and time, and
+            extrapolated flat in time.  This avoids the lookup in the
+            caches of the interpolation, e.g., in Monte Carlo
+            simulations on a fixed time grid.
+
+            The grid is built on the first lookup and again on the
+            first lookup after the interpolation notified a change;
+            the build is guarded by a mutex, so that lookups can be
+            run concurrently.
+        */
+        AndreasenHugeLocalVolAdapter(
+            ext::shared_ptr<AndreasenHugeVolatilityInterpl> localVol,
+            std::vector<Time> gridTimes,
+            Size nStrikes = 500);
 
         Date maxDate() const override;
         Real minStrike() const override;
@@ -45,11 +66,25 @@ namespace QuantLib {
         Natural settlementDays() const override;
         const Date& referenceDate() const override;
 
+        //! \name Observer interface
+        //@{
+        void update() override;
+        //@}
+
       protected:
         Volatility localVolImpl(Time t, Real strike) const override;
 
       private:
+        void buildGrid() const;
+
         const ext::shared_ptr<AndreasenHugeVolatilityInterpl> localVol_;
+
+        const std::vector<Time> gridTimes_;
+        const Size nGridStrikes_ = 0;
+        mutable std::atomic<bool> gridUpToDate_{false};
+        mutable std::mutex gridMutex_;
+        mutable Real lnMinStrike_ = 0.0, dLnStrike_ = 0.0;
+        mutable Matrix gridVols_;
     };
 }
 
@@ -27,6 +27,7 @@
 #include <ql/methods/finitedifferences/meshers/fdmmeshercomposite.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/firstderivativeop.hpp>
+#include <ql/methods/finitedifferences/operators/modtriplebandlinearop.hpp>
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
 #include <ql/methods/finitedifferences/tridiagonaloperator.hpp>
 #include <ql/pricingengines/blackcalculator.hpp>
@@ -35,6 +36,7 @@
 #include <ql/timegrid.hpp>
 #include <ql/utilities/null.hpp>
 #include <cmath>
+#include <exception>
 #include <limits>
 #include <utility>
 
@@ -69,59 +71,61 @@ namespace QuantLib {
                                  AndreasenHugeVolatilityInterpl::PiecewiseConstant),
           dxMap_(FirstDerivativeOp(0, mesher_)), dxxMap_(SecondDerivativeOp(0, mesher_)),
           d2CdK2_(dxMap_.mult(Array(mesher->layout()->size(), -1.0)).add(dxxMap_)),
-          mapT_(0, mesher_) {}
-
-        Array d2CdK2(const Array& c) const {
-            return d2CdK2_.apply(c);
-        }
-
-        Array solveFor(Time dT, const Array& sig, const Array& b) const {
-
-            Array x(lnMarketStrikes_.size());
-            Interpolation sigInterpl;
-
-            switch (interpolationType_) {
-              case AndreasenHugeVolatilityInterpl::CubicSpline:
-                sigInterpl = CubicNaturalSpline(
-                    lnMarketStrikes_.begin(), lnMarketStrikes_.end(),
-                    sig.begin());
-                break;
-              case AndreasenHugeVolatilityInterpl::Linear:
-                sigInterpl = LinearInterpolation(
-                    lnMarketStrikes_.begin(), lnMarketStrikes_.end(),
-                    sig.begin());
-                break;
-              case AndreasenHugeVolatilityInterpl::PiecewiseConstant:
+          volWeights_(nGridPoints_, lnMarketStrikes_.size()) {
+
+            // All interpolation schemes are linear in the volatilities
+            // at the market strikes; the volatilities on the grid are
+            // therefore given by a fixed matrix, calculated once by
+            // interpolating the unit vectors.
+            Array x(lnMarketStrikes_);
+            if (interpolationType_ == AndreasenHugeVolatilityInterpl::PiecewiseConstant) {
                 for (Size i=0; i < x.size()-1; ++i)
                     x[i] = 0.5*(lnMarketStrikes_[i] + lnMarketStrikes_[i+1]);
                 x.back() = lnMarketStrikes_.back();
-
-                sigInterpl = BackwardFlatInterpolation(
-                    x.begin(), x.end(), sig.begin());
-                break;
-              default:
-                QL_FAIL("unknown interpolation type");
             }
 
-            Array z(mesher_->layout()->size());
-            for (const auto& iter : *mesher_->layout()) {
-                const Size i = iter.index();
-                const Real lnStrike = mesher_->location(iter, 0);
-
-                const Real vol = sigInterpl(
-                    std::min(std::max(lnStrike, lnMarketStrikes_.front()),
-                            lnMarketStrikes_.back()), true);
-
-                z[i] = 0.5*vol*vol;
+            Array e(x.size(), 0.0);
+            for (Size k=0; k < x.size(); ++k) {
+                e[k] = 1.0;
+
+                Interpolation sigInterpl;
+                switch (interpolationType_) {
+                  case AndreasenHugeVolatilityInterpl::CubicSpline:
+                    sigInterpl = CubicNaturalSpline(x.begin(), x.end(), e.begin());
+                    break;
+                  case AndreasenHugeVolatilityInterpl::Linear:
+                    sigInterpl = LinearInterpolation(x.begin(), x.end(), e.begin());
+                    break;
+                  case AndreasenHugeVolatilityInterpl::PiecewiseConstant:
+                    sigInterpl = BackwardFlatInterpolation(x.begin(), x.end(), e.begin());
+                    break;
+                  default:
+                    QL_FAIL("unknown interpolation type");
+                }
+
+                for (const auto& iter : *mesher_->layout()) {
+                    const Real lnStrike = mesher_->location(iter, 0);
+                    volWeights_[iter.index()][k] = sigInterpl(
+                        std::min(std::max(lnStrike, lnMarketStrikes_.front()),
+                                lnMarketStrikes_.back()), true);
+                }
+
+                e[k] = 0.0;
             }
+        }
 
-            mapT_.axpyb(z, dxMap_, dxxMap_.mult(-z), Array());
-            return mapT_.mult(Array(z.size(), dT)).solve_splitting(b, 1.0);
+        Array d2CdK2(const Array& c) const {
+            return d2CdK2_.apply(c);
+        }
 
+        Array solveFor(Time dT, const Array& sig, const Array& b) const {
+            factorize(dT, sig);
+            return solve(b);
         }
 
         Array apply(const Array& c) const {
-            return -mapT_.apply(c);
+            // -z*(dx - dxx) c for the volatilities of the last step
+            return z_*d2CdK2_.apply(c);
         }
 
         Array values(const Array& sig) const override {
@@ -141,6 +145,43 @@ namespace QuantLib {
             return retVal;
         }
 
+        /*! The step solves \f$ (1 + \Delta t\, z\, D) c = c_{prev} \f$
+            with \f$ z = \sigma^2/2 \f$ and \f$ D = \partial_x - \partial_{xx} \f$;
+            differentiating it gives
+            \f[
+                \frac{\partial c}{\partial \sigma_k} =
+                    -(1 + \Delta t\, z\, D)^{-1}
+                     \Delta t\, \sigma\, w_k\, D c
+            \f]
+            where \f$ w_k \f$ are the interpolation weights of the
+            k-th volatility.  The factorization of the step is shared
+            by all parameters.  The derivatives of the prices at the
+            market strikes are taken on the natural cubic spline,
+            i.e., without the monotonicity filter used in values().
+        */
+        void jacobian(Matrix& jac, const Array& sig) const override {
+            factorize(dT_, sig);
+            const Array c = solve(previousNPVs_);
+            // d2CdK2 is -D
+            const Array minusDc = d2CdK2_.apply(c);
+
+            const std::vector<Real>& gridPoints =
+                mesher_->getFdm1dMeshers().front()->locations();
+
+            Array rhs(nGridPoints_);
+            for (Size k=0; k < sig.size(); ++k) {
+                for (Size i=0; i < nGridPoints_; ++i)
+                    rhs[i] = dT_*vol_[i]*volWeights_[i][k]*minusDc[i];
+
+                const Array dNPVs = solve(rhs);
+                const CubicNaturalSpline interpl(
+                    gridPoints.begin(), gridPoints.end(), dNPVs.begin());
+
+                for (Size j=0; j < lnMarketStrikes_.size(); ++j)
+                    jac[j][k] = interpl(lnMarketStrikes_[j]);
+            }
+        }
+
         Array vegaCalibrationError(const Array& sig) const {
             return values(sig)/marketVegas_;
         }
@@ -151,6 +192,50 @@ namespace QuantLib {
 
 
       private:
+        // LU decomposition of 1 + dT*z*(dx - dxx) for the given
+        // volatilities; it's kept until the next call with a
+        // different step or different volatilities.
+        void factorize(Time dT, const Array& sig) const {
+            if (dT == factorizedDT_ && sig.size() == factorizedSig_.size()
+                && std::equal(sig.begin(), sig.end(), factorizedSig_.begin()))
+                return;
+
+            vol_ = volWeights_*sig;
+            z_ = 0.5*vol_*vol_;
+
+            // the coefficients of dx - dxx are the opposite of d2CdK2
+            lower_.resize(nGridPoints_);
+            gamma_.resize(nGridPoints_);
+            invBeta_.resize(nGridPoints_);
+
+            Real upper = -dT*z_[0]*d2CdK2_.upper(0);
+            Real beta = 1.0 - dT*z_[0]*d2CdK2_.diag(0);
+            QL_REQUIRE(beta != 0.0, "division by zero");
+            invBeta_[0] = 1.0/beta;
+            for (Size i=1; i < nGridPoints_; ++i) {
+                const Real dTz = dT*z_[i];
+                lower_[i] = -dTz*d2CdK2_.lower(i);
+                gamma_[i] = upper*invBeta_[i-1];
+                beta = 1.0 - dTz*d2CdK2_.diag(i) - gamma_[i]*lower_[i];
+                QL_ENSURE(beta != 0.0, "division by zero");
+                invBeta_[i] = 1.0/beta;
+                upper = -dTz*d2CdK2_.upper(i);
+            }
+
+            factorizedDT_ = dT;
+            factorizedSig_ = sig;
+        }
+
+        Array solve(const Array& b) const {
+            Array x(nGridPoints_);
+            x[0] = b[0]*invBeta_[0];
+            for (Size i=1; i < nGridPoints_; ++i)
+                x[i] = (b[i] - lower_[i]*x[i-1])*invBeta_[i];
+            for (Size i=nGridPoints_-1; i > 0; --i)
+                x[i-1] -= gamma_[i]*x[i];
+            return x;
+        }
+
         const Array marketNPVs_, marketVegas_;
         const Array lnMarketStrikes_, previousNPVs_;
         const ext::shared_ptr<FdmMesherComposite> mesher_;
@@ -161,8 +246,12 @@ namespace QuantLib {
 
         const FirstDerivativeOp  dxMap_;
         const TripleBandLinearOp dxxMap_;
-        const TripleBandLinearOp d2CdK2_;
-        mutable TripleBandLinearOp mapT_;
+        const ModTripleBandLinearOp d2CdK2_;
+        Matrix volWeights_;
+
+        mutable Time factorizedDT_ = Null<Time>();
+        mutable Array factorizedSig_, vol_, z_;
+        mutable Array lower_, gamma_, invBeta_;
     };
 
     class CombinedCostFunction : public CostFunction {
@@ -173,8 +262,9 @@ namespace QuantLib {
 
         Array values(const Array& sig) const override {
             if ((putCostFct_ != nullptr) && (callCostFct_ != nullptr)) {
-                const Array pv = putCostFct_->values(sig);
-                const Array cv = callCostFct_->values(sig);
+                Array pv, cv;
+                inParallel([&]() { pv = putCostFct_->values(sig); },
+                           [&]() { cv = callCostFct_->values(sig); });
 
                 Array retVal(pv.size() + cv.size());
                 std::copy(pv.begin(), pv.end(), retVal.begin());
@@ -189,6 +279,23 @@ namespace QuantLib {
                 QL_FAIL("internal error: cost function not set");
         }
 
+        void jacobian(Matrix& jac, const Array& sig) const override {
+            if ((putCostFct_ != nullptr) && (callCostFct_ != nullptr)) {
+                const Size n = sig.size();
+                Matrix pj(jac.rows()/2, n), cj(jac.rows()/2, n);
+                inParallel([&]() { putCostFct_->jacobian(pj, sig); },
+                           [&]() { callCostFct_->jacobian(cj, sig); });
+
+                std::copy(pj.begin(), pj.end(), jac.begin());
+                std::copy(cj.begin(), cj.end(), jac.row_begin(pj.rows()));
+            } else if (putCostFct_ != nullptr)
+                putCostFct_->jacobian(jac, sig);
+            else if (callCostFct_ != nullptr)
+                callCostFct_->jacobian(jac, sig);
+            else
+                QL_FAIL("internal error: cost function not set");
+        }
+
         Array initialValues() const {
             if ((putCostFct_ != nullptr) && (callCostFct_ != nullptr))
                 return 0.5*(  putCostFct_->initialValues()
@@ -202,6 +309,28 @@ namespace QuantLib {
         }
 
       private:
+        // the put and call sides are evaluated in parallel when
+        // QuantLib is compiled with OpenMP support; two threads are
+        // all the work there is, so no larger team is started
+        template <class F1, class F2>
+        static void inParallel(const F1& f1, const F2& f2) {
+            std::exception_ptr errors[2];
+            #pragma omp parallel for num_threads(2)
+            for (int i=0; i < 2; ++i) {
+                try {
+                    if (i == 0)
+                        f1();
+                    else
+                        f2();
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+            for (const auto& error : errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+
         const ext::shared_ptr<AndreasenHugeCostFunction> putCostFct_;
         const ext::shared_ptr<AndreasenHugeCostFunction> callCostFct_;
     };
@@ -362,6 +491,7 @@ namespace QuantLib {
         gridInFwd_ = Exp(gridPoints_)*spot_->value();
 
         localVolCache_.clear();
+        priceCache_.clear();
         calibrationResults_.clear();
 
         avgError_ = 0.0;
@@ -508,6 +638,9 @@ namespace QuantLib {
     Real AndreasenHugeVolatilityInterpl::optionPrice(
         Time t, Real strike, Option::Type optionType) const {
 
+        // the cache is cleared by a recalculation
+        calculate();
+
         auto f = priceCache_.find(t);
 
         const DiscountFactor df = rTS_->discount(t);
@@ -526,9 +659,6 @@ namespace QuantLib {
             return price*df*fwd;
         }
 
-        calculate();
-
-
         ext::shared_ptr<Array> prices(
             ext::make_shared<Array>(gridPoints_));
 
@@ -590,13 +720,14 @@ namespace QuantLib {
 
     Volatility AndreasenHugeVolatilityInterpl::localVol(Time t, Real strike)
     const {
+        // the cache is cleared by a recalculation
+        calculate();
+
         auto f = localVolCache_.find(t);
 
         if (f != localVolCache_.end())
             return getCacheValue(strike, f);
 
-        calculate();
-
         ext::shared_ptr<Array> localVol(
             ext::make_shared<Array>(gridPoints_.size()));
 
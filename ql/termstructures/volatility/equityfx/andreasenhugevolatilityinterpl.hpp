@@ -48,6 +48,14 @@ namespace QuantLib {
 
         Andreasen J., Huge B., 2010. Volatility Interpolation
         https://ssrn.com/abstract=1694972
+
+        The calibration of each expiry provides the analytic Jacobian
+        of the price errors, which is used by optimization methods
+        supporting it, e.g., a LevenbergMarquardt instance with
+        useCostFunctionsJacobian set to true; the default optimizer
+        uses finite differences.  The put and call slices of CallPut
+        calibrations are evaluated in parallel when QuantLib is
+        compiled with OpenMP support.
     */
 
     class AndreasenHugeVolatilityInterpl : public LazyObject {
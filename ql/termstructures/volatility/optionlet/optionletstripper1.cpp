@@ -24,13 +24,12 @@
 
 #include <ql/termstructures/volatility/optionlet/optionletstripper1.hpp>
 #include <ql/instruments/makecapfloor.hpp>
-#include <ql/pricingengines/capfloor/blackcapfloorengine.hpp>
-#include <ql/pricingengine.hpp>
-#include <ql/pricingengines/capfloor/bacheliercapfloorengine.hpp>
 #include <ql/pricingengines/blackformula.hpp>
 #include <ql/indexes/iborindex.hpp>
-#include <ql/quotes/simplequote.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <exception>
+#include <map>
+#include <tuple>
 
 namespace QuantLib {
 
@@ -49,6 +48,7 @@ namespace QuantLib {
       floatingSwitchStrike_(switchStrike == Null<Rate>()), switchStrike_(switchStrike),
       accuracy_(accuracy), maxIter_(maxIter), dontThrow_(dontThrow) {
 
+        strippedStrikes_.assign(nStrikes_, false);
         capFloorPrices_ = Matrix(nOptionletTenors_, nStrikes_);
         optionletPrices_ = Matrix(nOptionletTenors_, nStrikes_);
         capletVols_ = Matrix(nOptionletTenors_, nStrikes_);
@@ -60,28 +60,84 @@ namespace QuantLib {
 
     void OptionletStripper1::performCalculations() const {
 
-        // update dates
+        const Date today = Settings::instance().evaluationDate();
         const Date& referenceDate = termVolSurface_->referenceDate();
         const DayCounter& dc = termVolSurface_->dayCounter();
-        ext::shared_ptr<BlackCapFloorEngine> dummy(new
-                    BlackCapFloorEngine(// discounting does not matter here
-                                        iborIndex_->forwardingTermStructure(),
-                                        0.20, dc));
+
+        // the caplets only depend on the evaluation date; the ones
+        // with the same dates are shared between the cap/floor lengths
+        if (capletsDate_ != today) {
+            caplets_.clear();
+            capFloorCaplets_.assign(nOptionletTenors_, std::vector<Size>());
+            std::map<std::tuple<Date, Date, Date, Date>, Size> positions;
+            for (Size i=0; i<nOptionletTenors_; ++i) {
+                ext::shared_ptr<CapFloor> capFloor =
+                    MakeCapFloor(CapFloor::Cap,
+                                 capFloorLengths_[i],
+                                 iborIndex_,
+                                 0.04, // dummy strike
+                                 0*Days);
+                for (const auto& cf : capFloor->floatingLeg()) {
+                    ext::shared_ptr<FloatingRateCoupon> coupon =
+                        ext::dynamic_pointer_cast<FloatingRateCoupon>(cf);
+                    QL_REQUIRE(coupon, "non-FloatingRateCoupon given");
+                    auto position = positions.emplace(
+                        std::make_tuple(coupon->fixingDate(), coupon->accrualStartDate(),
+                                        coupon->accrualEndDate(), coupon->date()),
+                        caplets_.size());
+                    if (position.second)
+                        caplets_.push_back({coupon});
+                    capFloorCaplets_[i].push_back(position.first->second);
+                }
+            }
+            capletsDate_ = today;
+            strippedStrikes_.assign(nStrikes_, false);
+        }
+
+        const Handle<YieldTermStructure>& discountCurve =
+            discount_.empty() ?
+                iborIndex_->forwardingTermStructure() :
+                discount_;
+
+        // forwards and discounted accruals as in the cap/floor engines;
+        // if any of them changed, all strikes are stripped again
+        const Date settlement = discountCurve->referenceDate();
+        bool marketChanged = false;
+        for (auto& caplet : caplets_) {
+            const FloatingRateCoupon& coupon = *caplet.coupon;
+            Rate forward = Null<Rate>();
+            Real discountedAccrual = 0.0;
+            Time sqrtTime = 0.0;
+            if (coupon.date() > settlement) {
+                forward = coupon.adjustedFixing();
+                discountedAccrual = discountCurve->discount(coupon.date()) *
+                    coupon.nominal() * coupon.gearing() * coupon.accrualPeriod();
+                if (coupon.fixingDate() > today)
+                    sqrtTime = std::sqrt(dc.yearFraction(today, coupon.fixingDate()));
+            }
+            if (forward != caplet.forward ||
+                discountedAccrual != caplet.discountedAccrual ||
+                sqrtTime != caplet.sqrtTime) {
+                caplet.forward = forward;
+                caplet.discountedAccrual = discountedAccrual;
+                caplet.sqrtTime = sqrtTime;
+                marketChanged = true;
+            }
+        }
+
+        std::vector<DiscountFactor> optionletAnnuities(nOptionletTenors_);
         for (Size i=0; i<nOptionletTenors_; ++i) {
-            CapFloor temp = MakeCapFloor(CapFloor::Cap,
-                                         capFloorLengths_[i],
-                                         iborIndex_,
-                                         0.04, // dummy strike
-                                         0*Days)
-                .withPricingEngine(dummy);
-            ext::shared_ptr<FloatingRateCoupon> lFRC =
-                                                temp.lastFloatingRateCoupon();
-            optionletDates_[i] = lFRC->fixingDate();
-            optionletPaymentDates_[i] = lFRC->date();
-            optionletAccrualPeriods_[i] = lFRC->accrualPeriod();
+            const FloatingRateCoupon& lFRC =
+                                *caplets_[capFloorCaplets_[i].back()].coupon;
+            optionletDates_[i] = lFRC.fixingDate();
+            optionletPaymentDates_[i] = lFRC.date();
+            optionletAccrualPeriods_[i] = lFRC.accrualPeriod();
             optionletTimes_[i] = dc.yearFraction(referenceDate,
                                                  optionletDates_[i]);
-            atmOptionletRate_[i] = lFRC->indexFixing();
+            atmOptionletRate_[i] = lFRC.indexFixing();
+            DiscountFactor d =
+                discountCurve->discount(optionletPaymentDates_[i]);
+            optionletAnnuities[i] = optionletAccrualPeriods_[i]*d;
         }
 
         if (floatingSwitchStrike_) {
@@ -92,89 +148,111 @@ namespace QuantLib {
             switchStrike_ = averageAtmOptionletRate / nOptionletTenors_;
         }
 
-        const Handle<YieldTermStructure>& discountCurve =
-            discount_.empty() ?
-                iborIndex_->forwardingTermStructure() :
-                discount_;
+        QL_REQUIRE(volatilityType_ == ShiftedLognormal || volatilityType_ == Normal,
+                   "unknown volatility type: " << volatilityType_);
 
+        // the term volatilities are read first, since the surface
+        // can't be used from multiple threads
         const std::vector<Rate>& strikes = termVolSurface_->strikes();
-
-        ext::shared_ptr<PricingEngine> capFloorEngine;
-        ext::shared_ptr<SimpleQuote> volQuote(new SimpleQuote);
-
-        if (volatilityType_ == ShiftedLognormal) {
-            capFloorEngine = ext::make_shared<BlackCapFloorEngine>(
-                        
-                            discountCurve, Handle<Quote>(volQuote),
-                            dc, displacement_);
-        } else if (volatilityType_ == Normal) {
-            capFloorEngine = ext::make_shared<BachelierCapFloorEngine>(
-                        
-                            discountCurve, Handle<Quote>(volQuote),
-                            dc);
-        } else {
-            QL_FAIL("unknown volatility type: " << volatilityType_);
-        }
-
+        std::vector<bool> changed(nStrikes_, marketChanged);
         for (Size j=0; j<nStrikes_; ++j) {
-            // using out-of-the-money options
-            CapFloor::Type capFloorType =
-                strikes[j] < switchStrike_ ? CapFloor::Floor : CapFloor::Cap;
-            Option::Type optionletType =
-                strikes[j] < switchStrike_ ? Option::Put : Option::Call;
-
-            Real previousCapFloorPrice = 0.0;
             for (Size i=0; i<nOptionletTenors_; ++i) {
-
-                capFloorVols_[i][j] = termVolSurface_->volatility(
+                Volatility vol = termVolSurface_->volatility(
                     capFloorLengths_[i], strikes[j], true);
-                volQuote->setValue(capFloorVols_[i][j]);
-                ext::shared_ptr<CapFloor> capFloor =
-                    MakeCapFloor(capFloorType, capFloorLengths_[i],
-                                 iborIndex_, strikes[j], -0 * Days)
-                        .withPricingEngine(capFloorEngine);
-                capFloorPrices_[i][j] = capFloor->NPV();
-                optionletPrices_[i][j] = capFloorPrices_[i][j] -
-                                                        previousCapFloorPrice;
-                previousCapFloorPrice = capFloorPrices_[i][j];
-                DiscountFactor d =
-                    discountCurve->discount(optionletPaymentDates_[i]);
-                DiscountFactor optionletAnnuity=optionletAccrualPeriods_[i]*d;
-                try {
-                  if (volatilityType_ == ShiftedLognormal) {
-                    optionletStDevs_[i][j] = blackFormulaImpliedStdDev(
-                        optionletType, strikes[j], atmOptionletRate_[i],
-                        optionletPrices_[i][j], optionletAnnuity, displacement_,
-                        optionletStDevs_[i][j], accuracy_, maxIter_);
-                  } else if (volatilityType_ == Normal) {
-                    optionletStDevs_[i][j] =
-                        std::sqrt(optionletTimes_[i]) *
-                        bachelierBlackFormulaImpliedVol(
-                            optionletType, strikes[j], atmOptionletRate_[i],
-                            optionletTimes_[i], optionletPrices_[i][j],
-                            optionletAnnuity);
-                  } else {
-                    QL_FAIL("Unknown volatility type: " << volatilityType_);
-                  }
+                if (vol != capFloorVols_[i][j] || !strippedStrikes_[j]) {
+                    capFloorVols_[i][j] = vol;
+                    changed[j] = true;
                 }
-                catch (std::exception &e) {
-                    if(dontThrow_)
-                        optionletStDevs_[i][j]=0.0;
-                    else
-                        QL_FAIL("could not bootstrap optionlet:"
-                            "\n type:    " << optionletType <<
-                            "\n strike:  " << io::rate(strikes[j]) <<
-                            "\n atm:     " << io::rate(atmOptionletRate_[i]) <<
-                            "\n price:   " << optionletPrices_[i][j] <<
-                            "\n annuity: " << optionletAnnuity <<
-                            "\n expiry:  " << optionletDates_[i] <<
-                            "\n error:   " << e.what());
+            }
+        }
+
+        std::vector<std::exception_ptr> errors(nStrikes_);
+        #pragma omp parallel for if(nStrikes_ > 1)
+        for (long j=0; j<long(nStrikes_); ++j) {
+            if (changed[j]) {
+                try {
+                    stripOptionlets(j, optionletAnnuities);
+                } catch (...) {
+                    errors[j] = std::current_exception();
                 }
-                optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
-                                                std::sqrt(optionletTimes_[i]);
             }
         }
 
+        for (Size j=0; j<nStrikes_; ++j) {
+            if (changed[j])
+                strippedStrikes_[j] = !errors[j];
+        }
+        for (Size j=0; j<nStrikes_; ++j) {
+            if (errors[j])
+                std::rethrow_exception(errors[j]);
+        }
+    }
+
+    void OptionletStripper1::stripOptionlets(
+                Size j, const std::vector<DiscountFactor>& optionletAnnuities) const {
+
+        const Rate strike = termVolSurface_->strikes()[j];
+
+        // using out-of-the-money options
+        const Option::Type optionletType =
+            strike < switchStrike_ ? Option::Put : Option::Call;
+
+        Real previousCapFloorPrice = 0.0;
+        for (Size i=0; i<nOptionletTenors_; ++i) {
+
+            const Volatility vol = capFloorVols_[i][j];
+            Real capFloorPrice = 0.0;
+            for (Size k : capFloorCaplets_[i]) {
+                const Caplet& caplet = caplets_[k];
+                if (caplet.forward == Null<Rate>())
+                    continue;
+                const FloatingRateCoupon& coupon = *caplet.coupon;
+                const Rate capletStrike = (strike - coupon.spread()) / coupon.gearing();
+                if (volatilityType_ == ShiftedLognormal)
+                    capFloorPrice += blackFormula(
+                        optionletType, capletStrike, caplet.forward,
+                        vol * caplet.sqrtTime, caplet.discountedAccrual, displacement_);
+                else
+                    capFloorPrice += bachelierBlackFormula(
+                        optionletType, capletStrike, caplet.forward,
+                        vol * caplet.sqrtTime, caplet.discountedAccrual);
+            }
+            capFloorPrices_[i][j] = capFloorPrice;
+            optionletPrices_[i][j] = capFloorPrices_[i][j] -
+                                                    previousCapFloorPrice;
+            previousCapFloorPrice = capFloorPrices_[i][j];
+            DiscountFactor optionletAnnuity = optionletAnnuities[i];
+            try {
+              if (volatilityType_ == ShiftedLognormal) {
+                optionletStDevs_[i][j] = blackFormulaImpliedStdDev(
+                    optionletType, strike, atmOptionletRate_[i],
+                    optionletPrices_[i][j], optionletAnnuity, displacement_,
+                    optionletStDevs_[i][j], accuracy_, maxIter_);
+              } else {
+                optionletStDevs_[i][j] =
+                    std::sqrt(optionletTimes_[i]) *
+                    bachelierBlackFormulaImpliedVol(
+                        optionletType, strike, atmOptionletRate_[i],
+                        optionletTimes_[i], optionletPrices_[i][j],
+                        optionletAnnuity);
+              }
+            }
+            catch (std::exception &e) {
+                if(dontThrow_)
+                    optionletStDevs_[i][j]=0.0;
+                else
+                    QL_FAIL("could not bootstrap optionlet:"
+                        "\n type:    " << optionletType <<
+                        "\n strike:  " << io::rate(strike) <<
+                        "\n atm:     " << io::rate(atmOptionletRate_[i]) <<
+                        "\n price:   " << optionletPrices_[i][j] <<
+                        "\n annuity: " << optionletAnnuity <<
+                        "\n expiry:  " << optionletDates_[i] <<
+                        "\n error:   " << e.what());
+            }
+            optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
+                                            std::sqrt(optionletTimes_[i]);
+        }
     }
 
     const Matrix &OptionletStripper1::capletVols() const {
@@ -35,11 +35,22 @@ namespace QuantLib {
 
     class SimpleQuote;
     class CapFloor;
+    class FloatingRateCoupon;
     class PricingEngine;
 
     /*! Helper class to strip optionlet (i.e. caplet/floorlet) volatilities
         (a.k.a. forward-forward volatilities) from the (cap/floor) term
         volatilities of a CapFloorTermVolSurface.
+
+        The caplets of the caps and floors are built once for each
+        evaluation date and shared between the caps of different
+        lengths; the caps are then priced directly with the Black or
+        Bachelier formula on the forwards and discounted accruals of
+        their caplets.  The strikes are stripped independently (in
+        parallel when QuantLib is compiled with OpenMP support) and,
+        on recalculation, only the strikes whose term volatilities
+        changed are stripped again unless the forwards or discounts
+        changed as well.
     */
     class OptionletStripper1 : public OptionletStripper {
       public:
@@ -66,6 +77,23 @@ namespace QuantLib {
         void performCalculations() const override;
         //@}
       private:
+        // caplet shared by the caps and floors with the same dates
+        struct Caplet {
+            ext::shared_ptr<FloatingRateCoupon> coupon;
+            // null forward for caplets paid before the settlement date
+            Rate forward = Null<Rate>();
+            Real discountedAccrual = 0.0;
+            Time sqrtTime = 0.0;
+        };
+        void stripOptionlets(Size strikeIndex,
+                             const std::vector<DiscountFactor>& optionletAnnuities) const;
+
+        mutable Date capletsDate_;
+        mutable std::vector<Caplet> caplets_;
+        // positions in caplets_ of the caplets of each cap/floor length
+        mutable std::vector<std::vector<Size> > capFloorCaplets_;
+        mutable std::vector<bool> strippedStrikes_;
+
         mutable Matrix capFloorPrices_, optionletPrices_;
         mutable Matrix capFloorVols_;
         mutable Matrix optionletStDevs_, capletVols_;
@@ -34,6 +34,82 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        // Hagan expansions for the SABR volatility; the terms that
+        // don't depend on the strike are calculated once, so that
+        // the same instance can be used for a whole smile.
+        class SabrExpansion {
+          public:
+            SabrExpansion(Rate forward, Time expiryTime,
+                          Real alpha, Real beta, Real nu, Real rho)
+            : forward_(forward), expiryTime_(expiryTime), alpha_(alpha),
+              beta_(beta), rho_(rho), oneMinusBeta_(1.0-beta),
+              oneMinusBeta2_(oneMinusBeta_*oneMinusBeta_),
+              nuOverAlpha_(nu/alpha), oneMinusRho_(1.0-rho),
+              c1LogNormal_(oneMinusBeta2_*alpha*alpha/24.0),
+              c1Normal_(-beta*(2.0-beta)*alpha*alpha/24.0),
+              c2_(0.25*rho*beta*nu*alpha),
+              c3_((2.0-3.0*rho*rho)*(nu*nu/24.0)),
+              expansionTerm_((3.0*rho*rho-2.0)/12.0) {}
+
+            Real logNormalVolatility(Rate strike) const {
+                const Real A = std::pow(forward_*strike, oneMinusBeta_);
+                const Real sqrtA = std::sqrt(A);
+                const Real logM = logMoneyness(strike);
+                const Real z = nuOverAlpha_*sqrtA*logM;
+                const Real C = oneMinusBeta2_*logM*logM;
+                const Real D = sqrtA*(1.0+C/24.0+C*C/1920.0);
+                const Real d = 1.0 + expiryTime_ *
+                    (c1LogNormal_/A + c2_/sqrtA + c3_);
+                return (alpha_/D)*multiplier(z)*d;
+            }
+
+            Real normalVolatility(Rate strike) const {
+                const Real A = std::pow(forward_*strike, oneMinusBeta_);
+                const Real sqrtA = std::sqrt(A);
+                const Real logM = logMoneyness(strike);
+                const Real z = nuOverAlpha_*sqrtA*logM;
+                const Real C = oneMinusBeta2_*logM*logM;
+                const Real D = logM*logM;
+                const Real E_1 = (1.0 + D/24.0 + D*D/1920.0);
+                const Real E_2 = (1.0 + C/24.0 + C*C/1920.0);
+                const Real d = 1.0 + expiryTime_ *
+                    (c1Normal_/A + c2_/sqrtA + c3_);
+                const Real F = alpha_*std::pow(forward_*strike, beta_/2.0);
+                return F*(E_1/E_2)*multiplier(z)*d;
+            }
+
+          private:
+            Real logMoneyness(Rate strike) const {
+                if (!close(forward_, strike))
+                    return std::log(forward_/strike);
+                const Real epsilon = (forward_-strike)/strike;
+                return epsilon - .5 * epsilon * epsilon;
+            }
+
+            Real multiplier(Real z) const {
+                // computations become precise enough if the square of z worth
+                // slightly more than the precision machine (hence the m)
+                static const Real m = 10;
+                if (std::fabs(z*z)>QL_EPSILON * m) {
+                    const Real B = 1.0-2.0*rho_*z+z*z;
+                    const Real xx = std::log((std::sqrt(B)+z-rho_)/oneMinusRho_);
+                    return z/xx;
+                }
+                return 1.0 - 0.5*rho_*z - expansionTerm_*z*z;
+            }
+
+            Real forward_, expiryTime_, alpha_, beta_, rho_;
+            Real oneMinusBeta_, oneMinusBeta2_, nuOverAlpha_, oneMinusRho_;
+            // coefficients of the time-dependent correction
+            // d = 1 + T (c1/A + c2/sqrt(A) + c3)
+            Real c1LogNormal_, c1Normal_, c2_, c3_;
+            Real expansionTerm_;
+        };
+
+    }
+
     Real unsafeSabrLogNormalVolatility(
                               Rate strike,
                               Rate forward,
@@ -42,37 +118,8 @@ namespace QuantLib {
                               Real beta,
                               Real nu,
                               Real rho) {
-        const Real oneMinusBeta = 1.0-beta;
-        const Real A = std::pow(forward*strike, oneMinusBeta);
-        const Real sqrtA= std::sqrt(A);
-        Real logM;
-        if (!close(forward, strike))
-            logM = std::log(forward/strike);
-        else {
-            const Real epsilon = (forward-strike)/strike;
-            logM = epsilon - .5 * epsilon * epsilon ;
-        }
-        const Real z = (nu/alpha)*sqrtA*logM;
-        const Real B = 1.0-2.0*rho*z+z*z;
-        const Real C = oneMinusBeta*oneMinusBeta*logM*logM;
-        const Real tmp = (std::sqrt(B)+z-rho)/(1.0-rho);
-        const Real xx = std::log(tmp);
-        const Real D = sqrtA*(1.0+C/24.0+C*C/1920.0);
-        const Real d = 1.0 + expiryTime *
-            (oneMinusBeta*oneMinusBeta*alpha*alpha/(24.0*A)
-                                + 0.25*rho*beta*nu*alpha/sqrtA
-                                    +(2.0-3.0*rho*rho)*(nu*nu/24.0));
-
-        Real multiplier;
-        // computations become precise enough if the square of z worth
-        // slightly more than the precision machine (hence the m)
-        static const Real m = 10;
-        if (std::fabs(z*z)>QL_EPSILON * m)
-            multiplier = z/xx;
-        else {
-            multiplier = 1.0 - 0.5*rho*z - (3.0*rho*rho-2.0)*z*z/12.0;
-        }
-        return (alpha/D)*multiplier*d;
+        return SabrExpansion(forward, expiryTime, alpha, beta, nu, rho)
+            .logNormalVolatility(strike);
     }
 
     Real unsafeShiftedSabrVolatility(Rate strike,
@@ -93,42 +140,8 @@ namespace QuantLib {
 
     Real unsafeSabrNormalVolatility(
         Rate strike, Rate forward, Time expiryTime, Real alpha, Real beta, Real nu, Real rho) {
-        const Real oneMinusBeta = 1.0 - beta;
-        const Real minusBeta = -1.0 * beta;
-        const Real A = std::pow(forward * strike, oneMinusBeta);
-        const Real sqrtA = std::sqrt(A);
-        Real logM;
-        if (!close(forward, strike))
-            logM = std::log(forward / strike);
-        else {
-            const Real epsilon = (forward - strike) / strike;
-            logM = epsilon - .5 * epsilon * epsilon;
-        }
-        const Real z = (nu / alpha) * sqrtA * logM;
-        const Real B = 1.0 - 2.0 * rho * z + z * z;
-        const Real C = oneMinusBeta * oneMinusBeta * logM * logM;
-        const Real D = logM * logM;
-        const Real tmp = (std::sqrt(B) + z - rho) / (1.0 - rho);
-        const Real xx = std::log(tmp);
-        const Real E_1 = (1.0 + D / 24.0 + D * D / 1920.0);
-        const Real E_2 = (1.0 + C / 24.0 + C * C / 1920.0);
-        const Real E = E_1 / E_2;
-        const Real d = 1.0 + expiryTime * (minusBeta * (2 - beta) * alpha * alpha / (24.0 * A) +
-                                0.25 * rho * beta * nu * alpha / sqrtA +
-                                (2.0 - 3.0 * rho * rho) * (nu * nu / 24.0));
-
-        Real multiplier;
-        // computations become precise enough if the square of z worth
-        // slightly more than the precision machine (hence the m)
-        static const Real m = 10;
-        if (std::fabs(z * z) > QL_EPSILON * m)
-            multiplier = z / xx;
-        else {
-            multiplier = 1.0 - 0.5 * rho * z - (3.0 * rho * rho - 2.0) * z * z / 12.0;
-        }
-        const Real F = alpha * std::pow(forward * strike, beta / 2.0);
-
-       return F * E * multiplier * d;
+        return SabrExpansion(forward, expiryTime, alpha, beta, nu, rho)
+            .normalVolatility(strike);
     }
 
      Real unsafeSabrVolatility(Rate strike,
@@ -146,6 +159,27 @@ namespace QuantLib {
         }
      }
 
+    std::vector<Real> unsafeShiftedSabrVolatilities(const std::vector<Rate>& strikes,
+                                                    Rate forward,
+                                                    Time expiryTime,
+                                                    Real alpha,
+                                                    Real beta,
+                                                    Real nu,
+                                                    Real rho,
+                                                    Real shift,
+                                                    VolatilityType volatilityType) {
+        const SabrExpansion sabr(forward + shift, expiryTime, alpha, beta, nu, rho);
+        std::vector<Real> result(strikes.size());
+        if (volatilityType == VolatilityType::Normal) {
+            for (Size i=0; i<strikes.size(); ++i)
+                result[i] = sabr.normalVolatility(strikes[i] + shift);
+        } else {
+            for (Size i=0; i<strikes.size(); ++i)
+                result[i] = sabr.logNormalVolatility(strikes[i] + shift);
+        }
+        return result;
+    }
+
     void validateSabrParameters(Real alpha,
                                 Real beta,
                                 Real nu,
@@ -199,6 +233,47 @@ namespace QuantLib {
                                              alpha, beta, nu, rho,shift, volatilityType);
     }
 
+    std::vector<Real> sabrVolatilities(const std::vector<Rate>& strikes,
+                                       Rate forward,
+                                       Time expiryTime,
+                                       Real alpha,
+                                       Real beta,
+                                       Real nu,
+                                       Real rho,
+                                       VolatilityType volatilityType) {
+        for (Rate strike : strikes)
+            QL_REQUIRE(strike>0.0, "strike must be positive: "
+                                   << io::rate(strike) << " not allowed");
+        QL_REQUIRE(forward>0.0, "at the money forward rate must be "
+                   "positive: " << io::rate(forward) << " not allowed");
+        QL_REQUIRE(expiryTime>=0.0, "expiry time must be non-negative: "
+                                   << expiryTime << " not allowed");
+        validateSabrParameters(alpha, beta, nu, rho);
+        return unsafeShiftedSabrVolatilities(strikes, forward, expiryTime,
+                                             alpha, beta, nu, rho, 0.0, volatilityType);
+    }
+
+    std::vector<Real> shiftedSabrVolatilities(const std::vector<Rate>& strikes,
+                                              Rate forward,
+                                              Time expiryTime,
+                                              Real alpha,
+                                              Real beta,
+                                              Real nu,
+                                              Real rho,
+                                              Real shift,
+                                              VolatilityType volatilityType) {
+        for (Rate strike : strikes)
+            QL_REQUIRE(strike + shift > 0.0, "strike+shift must be positive: "
+                       << io::rate(strike) << "+" << io::rate(shift) << " not allowed");
+        QL_REQUIRE(forward + shift > 0.0, "at the money forward rate + shift must be "
+                   "positive: " << io::rate(forward) << " " << io::rate(shift) << " not allowed");
+        QL_REQUIRE(expiryTime>=0.0, "expiry time must be non-negative: "
+                                   << expiryTime << " not allowed");
+        validateSabrParameters(alpha, beta, nu, rho);
+        return unsafeShiftedSabrVolatilities(strikes, forward, expiryTime,
+                                             alpha, beta, nu, rho, shift, volatilityType);
+    }
+
     namespace {
         struct SabrFlochKennedyVolatility {
             Real F, alpha, beta, nu, rho, t;
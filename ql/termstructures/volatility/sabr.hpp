@@ -31,6 +31,7 @@
 #include <ql/types.hpp>
 #include <ql/termstructures/volatility/volatilitytype.hpp>
 #include <array>
+#include <vector>
 
 namespace QuantLib {
 
@@ -91,6 +92,43 @@ namespace QuantLib {
                                  Real shift,
                                  VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
 
+    /*! Volatilities at a number of strikes for the same parameters;
+        the terms that don't depend on the strike are calculated once.
+        No check is performed on the inputs.
+    */
+    std::vector<Real> unsafeShiftedSabrVolatilities(
+                              const std::vector<Rate>& strikes,
+                              Rate forward,
+                              Time expiryTime,
+                              Real alpha,
+                              Real beta,
+                              Real nu,
+                              Real rho,
+                              Real shift,
+                              VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
+    /*! Volatilities at a number of strikes for the same parameters;
+        the parameters are validated once.
+    */
+    std::vector<Real> sabrVolatilities(const std::vector<Rate>& strikes,
+                                       Rate forward,
+                                       Time expiryTime,
+                                       Real alpha,
+                                       Real beta,
+                                       Real nu,
+                                       Real rho,
+                                       VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
+    std::vector<Real> shiftedSabrVolatilities(const std::vector<Rate>& strikes,
+                                              Rate forward,
+                                              Time expiryTime,
+                                              Real alpha,
+                                              Real beta,
+                                              Real nu,
+                                              Real rho,
+                                              Real shift,
+                                              VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
     Real sabrFlochKennedyVolatility(Rate strike,
                                     Rate forward,
                                     Time expiryTime,
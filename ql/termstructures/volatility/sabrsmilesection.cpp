@@ -20,6 +20,7 @@
 
 #include <ql/termstructures/volatility/sabrsmilesection.hpp>
 #include <ql/termstructures/volatility/sabr.hpp>
+#include <ql/math/interpolations/cubicinterpolation.hpp>
 #include <ql/utilities/dataformatters.hpp>
 
 namespace QuantLib {
@@ -62,16 +63,85 @@ namespace QuantLib {
         validateSabrParameters(alpha_, beta_, nu_, rho_);
     }
 
-     Real SabrSmileSection::varianceImpl(Rate strike) const {
+    SabrSmileSection::SabrSmileSection(const SabrSmileSection& other)
+    : SmileSection(other), alpha_(other.alpha_), beta_(other.beta_), nu_(other.nu_),
+      rho_(other.rho_), forward_(other.forward_), shift_(other.shift_),
+      gridPoints_(other.gridPoints_), gridVolatilities_(other.gridVolatilities_) {
+        buildGridInterpolation();
+    }
+
+    SabrSmileSection& SabrSmileSection::operator=(const SabrSmileSection& other) {
+        if (this != &other) {
+            SmileSection::operator=(other);
+            alpha_ = other.alpha_;
+            beta_ = other.beta_;
+            nu_ = other.nu_;
+            rho_ = other.rho_;
+            forward_ = other.forward_;
+            shift_ = other.shift_;
+            gridPoints_ = other.gridPoints_;
+            gridVolatilities_ = other.gridVolatilities_;
+            buildGridInterpolation();
+        }
+        return *this;
+    }
+
+    void SabrSmileSection::precomputeVolatilities(Size gridSize, Real stdDevs) {
+        QL_REQUIRE(gridSize > 1, "at least two grid points required");
+        QL_REQUIRE(stdDevs > 0.0, "positive number of standard deviations required");
+        const Real stdDev = sabrVolatility(forward_) * std::sqrt(exerciseTime());
+        QL_REQUIRE(stdDev > 0.0, "null at-the-money standard deviation");
+
+        // the grid is in log(strike + shift) for shifted lognormal
+        // volatilities and in strike for normal ones
+        const bool normal = volatilityType() == Normal;
+        const Real lowestStrike = 0.00001 - shift_;
+        const Real center = normal ? forward_ : std::log(forward_ + shift_);
+        const Real lowest = normal ? lowestStrike : std::log(lowestStrike + shift_);
+        const Real first = std::max(center - stdDevs * stdDev, lowest);
+        const Real last = center + stdDevs * stdDev;
+
+        gridPoints_.resize(gridSize);
+        std::vector<Real> strikes(gridSize);
+        for (Size i=0; i<gridSize; ++i) {
+            gridPoints_[i] = first + (last - first) * i / (gridSize - 1);
+            strikes[i] = normal ? gridPoints_[i] : std::exp(gridPoints_[i]) - shift_;
+        }
+        gridVolatilities_ = unsafeShiftedSabrVolatilities(
+            strikes, forward_, exerciseTime(), alpha_, beta_, nu_, rho_, shift_, volatilityType());
+        buildGridInterpolation();
+
+        notifyObservers();
+    }
+
+    void SabrSmileSection::buildGridInterpolation() {
+        if (gridPoints_.empty()) {
+            gridInterpolation_ = Interpolation();
+            return;
+        }
+        gridInterpolation_ = CubicNaturalSpline(gridPoints_.begin(), gridPoints_.end(),
+                                                gridVolatilities_.begin());
+        gridInterpolation_.update();
+    }
+
+    Volatility SabrSmileSection::sabrVolatility(Rate strike) const {
         strike = std::max(0.00001 - shift(),strike);
-        Volatility vol = unsafeShiftedSabrVolatility(
-            strike, forward_, exerciseTime(), alpha_, beta_, nu_, rho_, shift_, volatilityType());
+        if (!gridInterpolation_.empty()) {
+            const Real x =
+                volatilityType() == Normal ? strike : std::log(strike + shift_);
+            if (x >= gridPoints_.front() && x <= gridPoints_.back())
+                return gridInterpolation_(x);
+        }
+        return unsafeShiftedSabrVolatility(strike, forward_, exerciseTime(),
+                                           alpha_, beta_, nu_, rho_, shift_, volatilityType());
+    }
+
+     Real SabrSmileSection::varianceImpl(Rate strike) const {
+        Volatility vol = sabrVolatility(strike);
         return vol * vol * exerciseTime();
      }
 
      Real SabrSmileSection::volatilityImpl(Rate strike) const {
-        strike = std::max(0.00001 - shift(),strike);
-        return unsafeShiftedSabrVolatility(strike, forward_, exerciseTime(),
-                                           alpha_, beta_, nu_, rho_, shift_, volatilityType());
+        return sabrVolatility(strike);
      }
 }
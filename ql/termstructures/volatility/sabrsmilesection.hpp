@@ -25,6 +25,7 @@
 #ifndef quantlib_sabr_smile_section_hpp
 #define quantlib_sabr_smile_section_hpp
 
+#include <ql/math/interpolation.hpp>
 #include <ql/termstructures/volatility/smilesection.hpp>
 #include <ql/time/daycounters/actual365fixed.hpp>
 #include <vector>
@@ -45,6 +46,9 @@ namespace QuantLib {
                          const DayCounter& dc = Actual365Fixed(),
                          Real shift = 0.0,
                          VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+        //! the copies rebuild the interpolation on their own grid
+        SabrSmileSection(const SabrSmileSection& other);
+        SabrSmileSection& operator=(const SabrSmileSection& other);
 
         Real minStrike() const override { return -shift_; }
         Real maxStrike() const override { return QL_MAX_REAL; }
@@ -53,13 +57,27 @@ namespace QuantLib {
         Real beta() const { return beta_; }
         Real nu() const { return nu_; }
         Real rho() const { return rho_; }
+        /*! Precomputes the volatilities on a grid of the given size,
+            equally spaced in log-moneyness (in strike for normal
+            volatilities) within the given number of at-the-money
+            standard deviations from the forward.  Volatilities at
+            strikes inside the grid are then interpolated by a cubic
+            spline, which is faster than the closed formula when the
+            smile is queried many times, e.g., by CMS replication.
+            The closed formula is still used outside the grid.
+        */
+        void precomputeVolatilities(Size gridSize, Real stdDevs = 6.0);
       protected:
         Real varianceImpl(Rate strike) const override;
         Volatility volatilityImpl(Rate strike) const override;
 
       private:
         Real alpha_, beta_, nu_, rho_, forward_, shift_;
+        std::vector<Real> gridPoints_, gridVolatilities_;
+        Interpolation gridInterpolation_;
         void initialise(const std::vector<Real>& sabrParameters);
+        void buildGridInterpolation();
+        Volatility sabrVolatility(Rate strike) const;
     };
 
 
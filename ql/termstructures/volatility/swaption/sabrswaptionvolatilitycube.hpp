@@ -39,7 +39,9 @@
 #include <ql/quote.hpp>
 #include <ql/termstructures/volatility/sabrsmilesection.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolcube.hpp>
+#include <exception>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 
@@ -112,6 +114,21 @@ namespace QuantLib {
         }
     };
 
+    namespace detail {
+
+        // whether the smile sections of a model can precompute their
+        // volatilities on a strike grid
+        template <class Section, class = void>
+        struct HasStrikeGrid : std::false_type {};
+
+        template <class Section>
+        struct HasStrikeGrid<Section,
+                             std::void_t<decltype(std::declval<Section&>()
+                                                      .precomputeVolatilities(Size()))> >
+        : std::true_type {};
+
+    }
+
     //! XABR Swaption Volatility Cube
     /*! This class implements the XABR Swaption Volatility Cube
         which is a generic for different SABR, ZABR and
@@ -122,6 +139,24 @@ namespace QuantLib {
         - \c Interpolation: the interpolation type
         - \c SmileSection: the smile section type
 
+        The smiles are calibrated independently, in parallel when
+        QuantLib is compiled with OpenMP support and no optimization
+        method is passed.  When the cube is recalculated, only the
+        smiles whose inputs (forward, volatilities, guess) changed are
+        recalibrated; if \c warmStart is true, they start from the
+        results of the previous calibration instead of the guess,
+        which speeds up recalculations after small market moves.
+        Since the calibration might converge to a slightly different
+        point, the results then depend on the previous calibrations.
+
+        If \c smileGridSize is positive, the smile sections returned
+        by the cube precompute their volatilities on a strike grid of
+        that size (see SabrSmileSection::precomputeVolatilities) and
+        interpolate them afterwards.  This speeds up pricers that
+        query each section at many strikes, such as CMS replication,
+        at the cost of a small interpolation error.  It is supported
+        by the SABR and ZABR cubes.
+
         \see XabrModelTraits for customization points
     */
     template<class Model>
@@ -200,7 +235,9 @@ namespace QuantLib {
             bool useMaxError = false,
             Size maxGuesses = 50,
             bool backwardFlat = false,
-            Real cutoffStrike = 0.0001);
+            Real cutoffStrike = 0.0001,
+            bool warmStart = false,
+            Size smileGridSize = 0);
         //! \name LazyObject interface
         //@{
         void performCalculations() const override;
@@ -234,10 +271,15 @@ namespace QuantLib {
      protected:
         void registerWithParametersGuess();
         void setParameterGuess() const;
+        Volatility volatilityImpl(Time optionTime, Time swapLength, Rate strike) const override;
+        Volatility
+        volatilityImpl(const Date& optionDate, const Period& swapTenor, Rate strike) const override;
         ext::shared_ptr<SmileSection> smileSection(
                                     Time optionTime,
                                     Time swapLength,
                                     const Cube& sabrParametersCube) const;
+        ext::shared_ptr<SmileSection> calibratedSmileSection(Time optionTime,
+                                                             Time swapLength) const;
         Cube sabrCalibration(const Cube &marketVolCube) const;
         void fillVolatilityCube() const;
         void createSparseSmiles() const;
@@ -265,6 +307,24 @@ namespace QuantLib {
         const Real cutoffStrike_;
         VolatilityType volatilityType_;
 
+        // inputs and results of the calibration of a smile
+        struct SmileCalibration {
+            Time optionTime = Null<Time>();
+            Real forward = Null<Real>(), shift = Null<Real>();
+            std::vector<Real> strikes, volatilities, guess;
+            std::vector<bool> isParameterFixed;
+            std::vector<Real> parameters;
+            Real rmsError = Null<Real>(), maxError = Null<Real>();
+            Integer endCriteria = 0;
+        };
+        Cube sabrCalibration(const Cube& marketVolCube,
+                             std::vector<SmileCalibration>& calibrations) const;
+        void calibrateSmile(const SmileCalibration& inputs,
+                            SmileCalibration& calibration) const;
+        mutable std::vector<SmileCalibration> sparseCalibrations_, denseCalibrations_;
+        const bool warmStart_;
+        const Size smileGridSize_;
+
         class PrivateObserver : public Observer {
           public:
             explicit PrivateObserver(XabrSwaptionVolatilityCube<Model> *v)
@@ -306,7 +366,9 @@ namespace QuantLib {
         const bool useMaxError,
         const Size maxGuesses,
         const bool backwardFlat,
-        const Real cutoffStrike)
+        const Real cutoffStrike,
+        const bool warmStart,
+        const Size smileGridSize)
     : SwaptionVolatilityCube(atmVolStructure,
                              optionTenors,
                              swapTenors,
@@ -319,7 +381,12 @@ namespace QuantLib {
       isParameterFixed_(std::move(isParameterFixed)), isAtmCalibrated_(isAtmCalibrated),
       endCriteria_(std::move(endCriteria)), optMethod_(std::move(optMethod)),
       useMaxError_(useMaxError), maxGuesses_(maxGuesses), backwardFlat_(backwardFlat),
-      cutoffStrike_(cutoffStrike), volatilityType_(atmVolStructure->volatilityType()) {
+      cutoffStrike_(cutoffStrike), volatilityType_(atmVolStructure->volatilityType()),
+      warmStart_(warmStart), smileGridSize_(smileGridSize) {
+
+        QL_REQUIRE(smileGridSize_ == 0 ||
+                   detail::HasStrikeGrid<typename Model::SmileSection>::value,
+                   "the smile sections of this model can't precompute volatilities");
 
         if (maxErrorTolerance != Null<Rate>()) {
             maxErrorTolerance_ = maxErrorTolerance;
@@ -385,7 +452,7 @@ namespace QuantLib {
         }
         marketVolCube_.updateInterpolators();
 
-        sparseParameters_ = sabrCalibration(marketVolCube_);
+        sparseParameters_ = sabrCalibration(marketVolCube_, sparseCalibrations_);
         //parametersGuess_ = sparseParameters_;
         sparseParameters_.updateInterpolators();
         //parametersGuess_.updateInterpolators();
@@ -393,7 +460,7 @@ namespace QuantLib {
 
         if(isAtmCalibrated_){
             fillVolatilityCube();
-            denseParameters_ = sabrCalibration(volCubeAtmCalibrated_);
+            denseParameters_ = sabrCalibration(volCubeAtmCalibrated_, denseCalibrations_);
             denseParameters_.updateInterpolators();
         }
     }
@@ -402,7 +469,7 @@ namespace QuantLib {
         volCubeAtmCalibrated_ = marketVolCube_;
         if(isAtmCalibrated_){
             fillVolatilityCube();
-            denseParameters_ = sabrCalibration(volCubeAtmCalibrated_);
+            denseParameters_ = sabrCalibration(volCubeAtmCalibrated_, denseCalibrations_);
             denseParameters_.updateInterpolators();
         }
         notifyObservers();
@@ -411,6 +478,15 @@ namespace QuantLib {
     template <class Model>
     typename XabrSwaptionVolatilityCube<Model>::Cube
     XabrSwaptionVolatilityCube<Model>::sabrCalibration(const Cube &marketVolCube) const {
+        std::vector<SmileCalibration> calibrations;
+        return sabrCalibration(marketVolCube, calibrations);
+    }
+
+    template <class Model>
+    typename XabrSwaptionVolatilityCube<Model>::Cube
+    XabrSwaptionVolatilityCube<Model>::sabrCalibration(
+                           const Cube &marketVolCube,
+                           std::vector<SmileCalibration>& calibrations) const {
 
         const std::vector<Time>& optionTimes = marketVolCube.optionTimes();
         const std::vector<Time>& swapLengths = marketVolCube.swapLengths();
@@ -428,54 +504,65 @@ namespace QuantLib {
 
         const std::vector<Matrix>& tmpMarketVolCube = marketVolCube.points();
 
-        std::vector<Real> strikes(strikeSpreads_.size());
-        std::vector<Real> volatilities(strikeSpreads_.size());
-
+        // The inputs of all smiles are collected first, since the
+        // forwards are calculated by the swap indexes, which can't be
+        // used from multiple threads.
+        const Size nSwaps = swapLengths.size();
+        const Size nSmiles = optionTimes.size() * nSwaps;
+        std::vector<SmileCalibration> inputs(nSmiles);
         for (Size j=0; j<optionTimes.size(); j++) {
-            for (Size k=0; k<swapLengths.size(); k++) {
-                Rate atmForward = atmStrike(optionDates[j], swapTenors[k]);
-                Real shiftTmp = atmVol_->shift(optionTimes[j], swapLengths[k]);
-                strikes.clear();
-                volatilities.clear();
+            for (Size k=0; k<nSwaps; k++) {
+                SmileCalibration& smile = inputs[j*nSwaps + k];
+                smile.optionTime = optionTimes[j];
+                smile.forward = atmStrike(optionDates[j], swapTenors[k]);
+                smile.shift = atmVol_->shift(optionTimes[j], swapLengths[k]);
                 for (Size i=0; i<nStrikes_; i++){
-                    Real strike = atmForward+strikeSpreads_[i];
-                    if(strike + shiftTmp >=cutoffStrike_) {
-                        strikes.push_back(strike);
-                        volatilities.push_back(tmpMarketVolCube[i][j][k]);
+                    Real strike = smile.forward+strikeSpreads_[i];
+                    if(strike + smile.shift >=cutoffStrike_) {
+                        smile.strikes.push_back(strike);
+                        smile.volatilities.push_back(tmpMarketVolCube[i][j][k]);
                     }
                 }
+                smile.guess = parametersGuess_(optionTimes[j], swapLengths[k]);
+                smile.isParameterFixed = isParameterFixed_;
+            }
+        }
+
+        // The smiles are then calibrated in parallel when QuantLib is
+        // compiled with OpenMP support, unless an optimization method
+        // was passed (the same instance can't be used by different
+        // threads).  Smiles whose inputs didn't change since the last
+        // calibration are not recalibrated.
+        if (calibrations.size() != nSmiles)
+            calibrations.assign(nSmiles, SmileCalibration());
+        std::vector<std::exception_ptr> calibrationErrors(nSmiles);
+        #pragma omp parallel for if(!optMethod_ && nSmiles > 1)
+        for (long c=0; c<long(nSmiles); ++c) {
+            try {
+                calibrateSmile(inputs[c], calibrations[c]);
+            } catch (...) {
+                calibrationErrors[c] = std::current_exception();
+            }
+        }
 
-                const std::vector<Real>& guess =
-                    parametersGuess_(optionTimes[j], swapLengths[k]);
-
-                const ext::shared_ptr<typename Model::Interpolation> sabrInterpolation =
-                    Traits::createInterpolation(strikes.begin(), strikes.end(),
-                                                volatilities.begin(),
-                                                optionTimes[j], atmForward,
-                                                guess,
-                                                isParameterFixed_,
-                                                vegaWeightedSmileFit_,
-                                                endCriteria_,
-                                                optMethod_,
-                                                errorAccept_,
-                                                useMaxError_,
-                                                maxGuesses_,
-                                                shiftTmp,
-                                                volatilityType_);
-                sabrInterpolation->update();
-
-                Real rmsError = sabrInterpolation->rmsError();
-                Real maxError = sabrInterpolation->maxError();
-                alphas     [j][k] = sabrInterpolation->alpha();
-                betas      [j][k] = sabrInterpolation->beta();
-                nus        [j][k] = sabrInterpolation->nu();
-                rhos       [j][k] = sabrInterpolation->rho();
+        for (Size j=0; j<optionTimes.size(); j++) {
+            for (Size k=0; k<nSwaps; k++) {
+                if (calibrationErrors[j*nSwaps + k])
+                    std::rethrow_exception(calibrationErrors[j*nSwaps + k]);
+                const SmileCalibration& smile = calibrations[j*nSwaps + k];
+
+                Real rmsError = smile.rmsError;
+                Real maxError = smile.maxError;
+                alphas     [j][k] = smile.parameters[0];
+                betas      [j][k] = smile.parameters[1];
+                nus        [j][k] = smile.parameters[2];
+                rhos       [j][k] = smile.parameters[3];
                 if constexpr (Traits::nParams >= 5)
-                    gammas[j][k] = Traits::extractGamma(sabrInterpolation);
-                forwards   [j][k] = atmForward;
+                    gammas[j][k] = smile.parameters[4];
+                forwards   [j][k] = smile.forward;
                 errors     [j][k] = rmsError;
                 maxErrors  [j][k] = maxError;
-                endCriteria[j][k] = sabrInterpolation->endCriteria();
+                endCriteria[j][k] = smile.endCriteria;
 
                 // Build gamma diagnostic string only for models that have gamma (ZABR).
                 // if constexpr guarantees dead-branch elimination for 4-param models.
@@ -534,6 +621,65 @@ namespace QuantLib {
 
     }
 
+    template <class Model>
+    void XabrSwaptionVolatilityCube<Model>::calibrateSmile(
+                                          const SmileCalibration& inputs,
+                                          SmileCalibration& calibration) const {
+
+        const bool sameGuess = !calibration.parameters.empty() &&
+                               calibration.guess == inputs.guess &&
+                               calibration.isParameterFixed == inputs.isParameterFixed;
+        if (sameGuess && calibration.optionTime == inputs.optionTime &&
+            calibration.forward == inputs.forward && calibration.shift == inputs.shift &&
+            calibration.strikes == inputs.strikes &&
+            calibration.volatilities == inputs.volatilities)
+            return;
+
+        auto calibrate = [&](const std::vector<Real>& guess) {
+            SmileCalibration result = inputs;
+            const ext::shared_ptr<typename Model::Interpolation> sabrInterpolation =
+                Traits::createInterpolation(inputs.strikes.begin(), inputs.strikes.end(),
+                                            inputs.volatilities.begin(),
+                                            inputs.optionTime, inputs.forward,
+                                            guess,
+                                            inputs.isParameterFixed,
+                                            vegaWeightedSmileFit_,
+                                            endCriteria_,
+                                            optMethod_,
+                                            errorAccept_,
+                                            useMaxError_,
+                                            maxGuesses_,
+                                            inputs.shift,
+                                            volatilityType_);
+            sabrInterpolation->update();
+
+            result.parameters = { sabrInterpolation->alpha(), sabrInterpolation->beta(),
+                                  sabrInterpolation->nu(), sabrInterpolation->rho() };
+            if constexpr (Traits::nParams >= 5)
+                result.parameters.push_back(Traits::extractGamma(sabrInterpolation));
+            result.rmsError = sabrInterpolation->rmsError();
+            result.maxError = sabrInterpolation->maxError();
+            result.endCriteria = sabrInterpolation->endCriteria();
+            return result;
+        };
+
+        // when warm-starting, the free parameters start from the
+        // previous calibration (the fixed ones are the same, since
+        // the guess didn't change); if that fails, the calibration
+        // is repeated from the guess.
+        if (warmStart_ && sameGuess) {
+            SmileCalibration result = calibrate(calibration.parameters);
+            Real error = useMaxError_ ? result.maxError : result.rmsError;
+            if (result.endCriteria != Integer(EndCriteria::MaxIterations) &&
+                error < maxErrorTolerance_) {
+                calibration = std::move(result);
+                return;
+            }
+        }
+
+        calibration = calibrate(inputs.guess);
+    }
+
     template<class Model> void XabrSwaptionVolatilityCube<Model>::sabrCalibrationSection(
                                             const Cube& marketVolCube,
                                             Cube& parametersCube,
@@ -875,14 +1021,42 @@ namespace QuantLib {
     }
 
     template<class Model> ext::shared_ptr<SmileSection>
-    XabrSwaptionVolatilityCube<Model>::smileSectionImpl(Time optionTime,
-                                       Time swapLength) const {
+    XabrSwaptionVolatilityCube<Model>::calibratedSmileSection(Time optionTime,
+                                                              Time swapLength) const {
         if (isAtmCalibrated_)
             return smileSection(optionTime, swapLength, denseParameters_);
         else
             return smileSection(optionTime, swapLength, sparseParameters_);
     }
 
+    template<class Model> ext::shared_ptr<SmileSection>
+    XabrSwaptionVolatilityCube<Model>::smileSectionImpl(Time optionTime,
+                                       Time swapLength) const {
+        ext::shared_ptr<SmileSection> section =
+            calibratedSmileSection(optionTime, swapLength);
+        if constexpr (detail::HasStrikeGrid<typename Model::SmileSection>::value) {
+            if (smileGridSize_ > 0)
+                ext::static_pointer_cast<typename Model::SmileSection>(section)
+                    ->precomputeVolatilities(smileGridSize_);
+        }
+        return section;
+    }
+
+    // single volatilities are calculated without building the strike grid
+    template<class Model> Volatility
+    XabrSwaptionVolatilityCube<Model>::volatilityImpl(Time optionTime,
+                                                      Time swapLength,
+                                                      Rate strike) const {
+        return calibratedSmileSection(optionTime, swapLength)->volatility(strike);
+    }
+
+    template<class Model> Volatility
+    XabrSwaptionVolatilityCube<Model>::volatilityImpl(const Date& optionDate,
+                                                      const Period& swapTenor,
+                                                      Rate strike) const {
+        return volatilityImpl(timeFromReference(optionDate), swapLength(swapTenor), strike);
+    }
+
     template<class Model> Matrix XabrSwaptionVolatilityCube<Model>::sparseSabrParameters() const {
         calculate();
         return sparseParameters_.browse();
@@ -57,6 +57,9 @@ template <typename Evaluation> class ZabrSmileSection : public SmileSection {
                      const DayCounter& dc = Actual365Fixed(),
                      const std::vector<Real>& moneyness = std::vector<Real>(),
                      Size fdRefinement = 5);
+    // the interpolations refer to the strikes and values stored in the section
+    ZabrSmileSection(const ZabrSmileSection&) = delete;
+    ZabrSmileSection& operator=(const ZabrSmileSection&) = delete;
 
     Real minStrike() const override { return 0.0; }
     Real maxStrike() const override { return QL_MAX_REAL; }
@@ -68,8 +71,25 @@ template <typename Evaluation> class ZabrSmileSection : public SmileSection {
 
     ext::shared_ptr<ZabrModel> model() { return model_; }
 
+    /*! Precomputes the volatilities on a grid of the given size,
+        equally spaced in log-strike within the given number of
+        at-the-money standard deviations from the forward.
+        Volatilities at strikes inside the grid are then interpolated
+        by a cubic spline instead of being calculated by the model,
+        which is much faster when the smile is queried many times,
+        e.g., by CMS replication.  For the short-maturity lognormal
+        kernel, the grid is calculated with a single integration
+        across all its strikes.
+    */
+    void precomputeVolatilities(Size gridSize, Real stdDevs = 6.0);
+
   protected:
     Volatility volatilityImpl(Rate strike) const override {
+        if (!gridInterpolation_.empty() && strike > 0.0) {
+            const Real x = std::log(strike);
+            if (x >= gridPoints_.front() && x <= gridPoints_.back())
+                return gridInterpolation_(x);
+        }
         return volatilityImpl(strike, Evaluation());
     }
 
@@ -103,6 +123,10 @@ template <typename Evaluation> class ZabrSmileSection : public SmileSection {
     Volatility volatilityImpl(Rate strike, ZabrShortMaturityNormal) const;
     Volatility volatilityImpl(Rate strike, ZabrLocalVolatility) const;
     Volatility volatilityImpl(Rate strike, ZabrFullFd) const;
+    template <class Kernel>
+    std::vector<Real> gridVolatilities(const std::vector<Real>& strikes, Kernel) const;
+    std::vector<Real> gridVolatilities(const std::vector<Real>& strikes,
+                                       ZabrShortMaturityLognormal) const;
     ext::shared_ptr<ZabrModel> model_;
     Evaluation evaluation_;
     Rate forward_;
@@ -111,6 +135,8 @@ template <typename Evaluation> class ZabrSmileSection : public SmileSection {
     std::vector<Real> strikes_, callPrices_;
     ext::shared_ptr<Interpolation> callPriceFct_;
     Real a_, b_;
+    std::vector<Real> gridPoints_, gridVolatilities_;
+    Interpolation gridInterpolation_;
 };
 
 template <typename Evaluation>
@@ -258,6 +284,58 @@ void ZabrSmileSection<Evaluation>::init3(ZabrFullFd) {
     init3(ZabrLocalVolatility());
 }
 
+template <typename Evaluation>
+void ZabrSmileSection<Evaluation>::precomputeVolatilities(Size gridSize, Real stdDevs) {
+    QL_REQUIRE(gridSize > 1, "at least two grid points required");
+    QL_REQUIRE(stdDevs > 0.0, "positive number of standard deviations required");
+    const Real stdDev = volatilityImpl(forward_, Evaluation()) * std::sqrt(exerciseTime());
+    QL_REQUIRE(stdDev > 0.0, "null at-the-money standard deviation");
+
+    const Real center = std::log(forward_);
+    const Real first = std::max(center - stdDevs * stdDev, std::log(1E-6));
+    const Real last = center + stdDevs * stdDev;
+    std::vector<Real> points(gridSize), strikes(gridSize);
+    for (Size i = 0; i < gridSize; ++i) {
+        points[i] = first + (last - first) * i / (gridSize - 1);
+        strikes[i] = std::exp(points[i]);
+    }
+    std::vector<Real> volatilities = gridVolatilities(strikes, Evaluation());
+
+    // implied volatilities might not be available far in the wings;
+    // the grid is restricted to the points where they are
+    Size begin = 0, end = gridSize;
+    while (begin < end && volatilities[begin] <= 0.0)
+        ++begin;
+    while (end > begin && volatilities[end - 1] <= 0.0)
+        --end;
+    QL_REQUIRE(end - begin > 1, "no volatilities available on the grid");
+    gridPoints_.assign(points.begin() + begin, points.begin() + end);
+    gridVolatilities_.assign(volatilities.begin() + begin, volatilities.begin() + end);
+    gridInterpolation_ = CubicNaturalSpline(gridPoints_.begin(), gridPoints_.end(),
+                                            gridVolatilities_.begin());
+    gridInterpolation_.update();
+
+    notifyObservers();
+}
+
+template <typename Evaluation>
+template <class Kernel>
+std::vector<Real>
+ZabrSmileSection<Evaluation>::gridVolatilities(const std::vector<Real>& strikes,
+                                               Kernel) const {
+    std::vector<Real> volatilities(strikes.size());
+    for (Size i = 0; i < strikes.size(); ++i)
+        volatilities[i] = volatilityImpl(strikes[i], Kernel());
+    return volatilities;
+}
+
+template <typename Evaluation>
+std::vector<Real>
+ZabrSmileSection<Evaluation>::gridVolatilities(const std::vector<Real>& strikes,
+                                               ZabrShortMaturityLognormal) const {
+    return model_->lognormalVolatility(strikes);
+}
+
 template <typename Evaluation>
 Real
 ZabrSmileSection<Evaluation>::optionPrice(Real strike, Option::Type type,
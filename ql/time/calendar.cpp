@@ -24,11 +24,27 @@
 
 #include <ql/time/calendar.hpp>
 #include <ql/errors.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 
 namespace QuantLib {
 
     namespace {
 
+        /* Incremented whenever the holidays or rules of any calendar
+           change; precomputed business days built at an earlier
+           version are not used, since the calendar might depend on
+           the modified one (e.g., a joint calendar.) */
+        std::atomic<unsigned long> rulesVersion(0);
+
+        int bitCount(std::uint64_t x) {
+            x = x - ((x >> 1) & 0x5555555555555555ULL);
+            x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+            x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+        }
+
         // Requires: from < to.
         Date::serial_type daysBetweenImpl(const Calendar& cal,
                                           const Date& from, const Date& to,
@@ -42,6 +58,97 @@ namespace QuantLib {
 
     }
 
+    // business days stored as a bitmap, together with the number of
+    // business days preceding each 64-day word for rank/select lookups
+    class Calendar::BusinessDays {
+      public:
+        BusinessDays(const Calendar& calendar, Year from, Year to)
+        : firstYear(from), lastYear(to), version(rulesVersion.load()),
+          first_(Date(1, January, from).serialNumber()),
+          last_(Date(31, December, to).serialNumber()) {
+            const Date::serial_type n = last_ - first_ + 1;
+            // one more word, so that rank(last_+1) is always defined
+            bits_.resize(n/64 + 1, 0);
+            ranks_.resize(bits_.size(), 0);
+            for (Date::serial_type i=0; i<n; ++i) {
+                if (calendar.isBusinessDay(Date(first_ + i)))
+                    bits_[i/64] |= std::uint64_t(1) << (i%64);
+            }
+            for (Size w=1; w<bits_.size(); ++w)
+                ranks_[w] = ranks_[w-1] + bitCount(bits_[w-1]);
+            total_ = ranks_.back() + bitCount(bits_.back());
+        }
+        bool covers(Date::serial_type s) const {
+            return s >= first_ && s <= last_;
+        }
+        bool isBusinessDay(Date::serial_type s) const {
+            const Date::serial_type i = s - first_;
+            return ((bits_[i/64] >> (i%64)) & 1U) != 0;
+        }
+        // number of business days in [first_, s) for s in [first_, last_+1]
+        Date::serial_type rank(Date::serial_type s) const {
+            const Date::serial_type i = s - first_;
+            const std::uint64_t mask = (std::uint64_t(1) << (i%64)) - 1;
+            return ranks_[i/64] + bitCount(bits_[i/64] & mask);
+        }
+        // the business day with the given rank, or 0 if out of range
+        Date::serial_type select(Date::serial_type k) const {
+            if (k < 0 || k >= total_)
+                return 0;
+            const Size w =
+                std::upper_bound(ranks_.begin(), ranks_.end(), k) - ranks_.begin() - 1;
+            std::uint64_t x = bits_[w];
+            for (Date::serial_type j = k - ranks_[w]; j > 0; --j)
+                x &= x - 1;
+            // position of the lowest bit left
+            const std::uint64_t lowest = x & (~x + 1);
+            return first_ + Date::serial_type(w*64) + bitCount(lowest - 1);
+        }
+        const Year firstYear, lastYear;
+        const unsigned long version;
+      private:
+        Date::serial_type first_, last_, total_;
+        std::vector<std::uint64_t> bits_;
+        std::vector<Date::serial_type> ranks_;
+    };
+
+    void Calendar::precomputeBusinessDays(Year from, Year to) {
+        QL_REQUIRE(impl_, "no calendar implementation provided");
+        QL_REQUIRE(from <= to,
+                   "first year (" << from << ") after last year (" << to << ")");
+        // the new values must not be read from the old ones
+        impl_->businessDays.reset();
+        impl_->businessDays = ext::make_shared<const BusinessDays>(*this, from, to);
+    }
+
+    void Calendar::clearPrecomputedBusinessDays() {
+        QL_REQUIRE(impl_, "no calendar implementation provided");
+        impl_->businessDays.reset();
+    }
+
+    void Calendar::rulesChanged() {
+        ++rulesVersion;
+        if (impl_->businessDays)
+            precomputeBusinessDays(impl_->businessDays->firstYear,
+                                   impl_->businessDays->lastYear);
+    }
+
+    const Calendar::BusinessDays* Calendar::currentBusinessDays() const {
+        const BusinessDays* businessDays = impl_->businessDays.get();
+        if (businessDays != nullptr && businessDays->version == rulesVersion.load())
+            return businessDays;
+        return nullptr;
+    }
+
+    bool Calendar::precomputedBusinessDay(const Date& d, bool& isBusinessDay) const {
+        const BusinessDays* businessDays = currentBusinessDays();
+        const Date::serial_type s = d.serialNumber();
+        if (businessDays == nullptr || !businessDays->covers(s))
+            return false;
+        isBusinessDay = businessDays->isBusinessDay(s);
+        return true;
+    }
+
     void Calendar::addHoliday(const Date& d) {
         QL_REQUIRE(impl_, "no calendar implementation provided");
 
@@ -57,6 +164,7 @@ namespace QuantLib {
         // Otherwise, add it.
         if (impl_->isBusinessDay(_d))
             impl_->addedHolidays.insert(_d);
+        rulesChanged();
     }
 
     void Calendar::removeHoliday(const Date& d) {
@@ -74,11 +182,13 @@ namespace QuantLib {
         // Otherwise, add it.
         if (!impl_->isBusinessDay(_d))
             impl_->removedHolidays.insert(_d);
+        rulesChanged();
     }
 
     void Calendar::resetAddedAndRemovedHolidays() {
         impl_->addedHolidays.clear();
         impl_->removedHolidays.clear();
+        rulesChanged();
     }
 
     Date Calendar::adjust(const Date& d,
@@ -135,6 +245,16 @@ namespace QuantLib {
         if (n == 0) {
             return adjust(d,c);
         } else if (unit == Days) {
+            const BusinessDays* businessDays = currentBusinessDays();
+            const Date::serial_type s = d.serialNumber();
+            if (businessDays != nullptr && businessDays->covers(s)) {
+                // the n-th business day after (or before) d
+                const Date::serial_type target = n > 0 ?
+                    businessDays->select(businessDays->rank(s + 1) + n - 1) :
+                    businessDays->select(businessDays->rank(s) + n);
+                if (target != 0)
+                    return d + (target - s);
+            }
             Date d1 = d;
             if (n > 0) {
                 while (n > 0) {
@@ -183,6 +303,22 @@ namespace QuantLib {
                                                     const Date& to,
                                                     bool includeFirst,
                                                     bool includeLast) const {
+#ifndef QL_HIGH_RESOLUTION_DATE
+        const BusinessDays* businessDays = currentBusinessDays();
+        if (businessDays != nullptr && from != to &&
+            businessDays->covers(from.serialNumber()) &&
+            businessDays->covers(to.serialNumber())) {
+            const bool forward = from < to;
+            const Date::serial_type s1 = std::min(from, to).serialNumber(),
+                                    s2 = std::max(from, to).serialNumber();
+            const bool first = forward ? includeFirst : includeLast,
+                       last = forward ? includeLast : includeFirst;
+            const Date::serial_type result =
+                businessDays->rank(s2) - businessDays->rank(first ? s1 : s1 + 1)
+                + Date::serial_type(last && businessDays->isBusinessDay(s2));
+            return forward ? result : -result;
+        }
+#endif
         return (from < to) ? daysBetweenImpl(*this, from, to, includeFirst, includeLast) :
                (from > to) ? -daysBetweenImpl(*this, to, from, includeLast, includeFirst) :
                Date::serial_type(includeFirst && includeLast && isBusinessDay(from));
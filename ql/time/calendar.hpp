@@ -52,6 +52,12 @@ namespace QuantLib {
         or for general country holiday schedule. Legacy city holiday schedule
         calendars will be moved to the exchange/country convention.
 
+        The business days over a range of years can be precomputed
+        and stored as a bitmap; in that range, checking a date,
+        advancing by a number of business days and counting the
+        business days between two dates become constant-time lookups
+        instead of day-by-day iterations.
+
         \ingroup datetime
 
         \test the methods for adding and removing holidays are tested
@@ -60,6 +66,7 @@ namespace QuantLib {
     */
     class Calendar {
       protected:
+        class BusinessDays;
         //! abstract base class for calendar implementations
         class Impl {
           public:
@@ -68,8 +75,13 @@ namespace QuantLib {
             virtual bool isBusinessDay(const Date&) const = 0;
             virtual bool isWeekend(Weekday) const = 0;
             std::set<Date> addedHolidays, removedHolidays;
+            ext::shared_ptr<const BusinessDays> businessDays;
         };
         ext::shared_ptr<Impl> impl_;
+        /*! to be called by derived calendars after modifying the
+            rules of their implementation, e.g., their weekend days.
+        */
+        void rulesChanged();
       public:
         /*! The default constructor returns a calendar with a null
             implementation, which is therefore unusable except as a
@@ -99,6 +111,23 @@ namespace QuantLib {
         /*! Clear the set of added and removed holidays */
         void resetAddedAndRemovedHolidays();
 
+        /*! Precomputes the business days from the start of the first
+            to the end of the last given year.  The results are shared
+            by all the calendars with the same implementation (e.g.,
+            all TARGET instances) and are updated when holidays are
+            added to or removed from them; if the holidays or rules of
+            any other calendar change, the precomputed days are no
+            longer used (so that joint calendars stay consistent)
+            until this method is called again.
+
+            \warning as when adding holidays, this modifies the
+                     calendar and should not be done while other
+                     threads are using it.
+        */
+        void precomputeBusinessDays(Year from, Year to);
+        /*! Discards the precomputed business days, if any */
+        void clearPrecomputedBusinessDays();
+
         bool isBusinessDay(const Date& d) const;
         /*! Returns <tt>true</tt> iff the date is a holiday for the given
             market.
@@ -188,6 +217,9 @@ namespace QuantLib {
             //! expressed relative to first day of year
             static Day easterMonday(Year);
         };
+      private:
+        bool precomputedBusinessDay(const Date&, bool& isBusinessDay) const;
+        const BusinessDays* currentBusinessDays() const;
     };
 
     /*! Returns <tt>true</tt> iff the two calendars belong to the same
@@ -235,6 +267,9 @@ namespace QuantLib {
         const Date& _d = d;
 #endif
 
+        bool result;
+        if (impl_->businessDays && precomputedBusinessDay(_d, result))
+            return result;
         if (!impl_->addedHolidays.empty() &&
             impl_->addedHolidays.find(_d) != impl_->addedHolidays.end())
             return false;
@@ -59,16 +59,17 @@ namespace QuantLib {
                        const ext::optional<bool>& endOfMonth,
                        std::vector<bool> isRegular)
     : tenor_(tenor), calendar_(std::move(calendar)), convention_(convention),
-      terminationDateConvention_(terminationDateConvention), rule_(rule), dates_(dates),
-      isRegular_(std::move(isRegular)) {
+      terminationDateConvention_(terminationDateConvention), rule_(rule),
+      data_(ext::make_shared<const Data>(Data{dates, std::move(isRegular)})) {
 
         if (tenor && !allowsEndOfMonth(*tenor))
             endOfMonth_ = false;
         else
             endOfMonth_ = endOfMonth;
 
-        QL_REQUIRE(isRegular_.empty() || isRegular_.size() == dates.size() - 1,
-                   "isRegular size (" << isRegular_.size()
+        QL_REQUIRE(data_->isRegular.empty() ||
+                       data_->isRegular.size() == dates.size() - 1,
+                   "isRegular size (" << data_->isRegular.size()
                                       << ") must be zero or equal to the number of dates minus 1 ("
                                       << dates.size() - 1 << ")");
     }
@@ -179,6 +180,9 @@ namespace QuantLib {
         }
 
 
+        std::vector<Date> dates;
+        std::vector<bool> regular;
+
         // calendar needed for endOfMonth adjustment
         Calendar nullCalendar = NullCalendar();
         Integer periods = 1;
@@ -187,21 +191,21 @@ namespace QuantLib {
 
           case DateGeneration::Zero:
             tenor_ = 0*Years;
-            dates_.push_back(effectiveDate);
-            dates_.push_back(terminationDate);
-            isRegular_.push_back(true);
+            dates.push_back(effectiveDate);
+            dates.push_back(terminationDate);
+            regular.push_back(true);
             break;
 
           case DateGeneration::Backward:
 
-            dates_.push_back(terminationDate);
+            dates.push_back(terminationDate);
 
             seed = terminationDate;
             if (nextToLastDate_ != Date()) {
-                dates_.push_back(nextToLastDate_);
+                dates.push_back(nextToLastDate_);
                 Date temp = nullCalendar.advance(seed,
                     -periods*(*tenor_), convention, *endOfMonth_);
-                isRegular_.push_back(temp == nextToLastDate_);
+                regular.push_back(temp == nextToLastDate_);
                 seed = nextToLastDate_;
             }
 
@@ -214,11 +218,11 @@ namespace QuantLib {
                     -periods*(*tenor_), convention, *endOfMonth_);
                 if (temp < exitDate) {
                     if (firstDate_ != Date() &&
-                        (calendar_.adjust(dates_.back(),convention)!=
+                        (calendar_.adjust(dates.back(),convention)!=
                          calendar_.adjust(firstDate_,convention))) {
-                        dates_.push_back(firstDate_);
-                        isRegular_.push_back(
-                            nullCalendar.advance(dates_[dates_.size()-2],
+                        dates.push_back(firstDate_);
+                        regular.push_back(
+                            nullCalendar.advance(dates[dates.size()-2],
                                 -1*(*tenor_), convention, *endOfMonth_) ==
                             firstDate_);
                     }
@@ -226,25 +230,25 @@ namespace QuantLib {
                 } else {
                     // skip dates that would result in duplicates
                     // after adjustment
-                    if (calendar_.adjust(dates_.back(),convention)!=
+                    if (calendar_.adjust(dates.back(),convention)!=
                         calendar_.adjust(temp,convention)) {
-                        dates_.push_back(temp);
-                        isRegular_.push_back(true);
+                        dates.push_back(temp);
+                        regular.push_back(true);
                     }
                     ++periods;
                 }
             }
 
-            if (calendar_.adjust(dates_.back(),convention)!=
+            if (calendar_.adjust(dates.back(),convention)!=
                 calendar_.adjust(effectiveDate,convention)) {
-                dates_.push_back(effectiveDate);
-                isRegular_.push_back(
-                    nullCalendar.advance(dates_[dates_.size()-2],
+                dates.push_back(effectiveDate);
+                regular.push_back(
+                    nullCalendar.advance(dates[dates.size()-2],
                         -1*(*tenor_), convention, *endOfMonth_) ==
                     effectiveDate);
             }
-	    std::reverse(dates_.begin(), dates_.end());
-	    std::reverse(isRegular_.begin(), isRegular_.end());
+	    std::reverse(dates.begin(), dates.end());
+	    std::reverse(regular.begin(), regular.end());
             break;
 
           case DateGeneration::Twentieth:
@@ -263,24 +267,24 @@ namespace QuantLib {
             if (*rule_ == DateGeneration::CDS || *rule_ == DateGeneration::CDS2015) {
                 Date prev20th = previousTwentieth(effectiveDate, *rule_);
                 if (calendar_.adjust(prev20th, convention) > effectiveDate) {
-                    dates_.push_back(prev20th - 3 * Months);
-                    isRegular_.push_back(true);
+                    dates.push_back(prev20th - 3 * Months);
+                    regular.push_back(true);
                 }
-                dates_.push_back(prev20th);
+                dates.push_back(prev20th);
             } else {
-                dates_.push_back(effectiveDate);
+                dates.push_back(effectiveDate);
             }
 
-            seed = dates_.back();
+            seed = dates.back();
 
             if (firstDate_!=Date()) {
-                dates_.push_back(firstDate_);
+                dates.push_back(firstDate_);
                 Date temp = nullCalendar.advance(seed, periods*(*tenor_),
                                                  convention, *endOfMonth_);
                 if (temp!=firstDate_)
-                    isRegular_.push_back(false);
+                    regular.push_back(false);
                 else
-                    isRegular_.push_back(true);
+                    regular.push_back(true);
                 seed = firstDate_;
             } else if (*rule_ == DateGeneration::Twentieth ||
                        *rule_ == DateGeneration::TwentiethIMM ||
@@ -297,8 +301,8 @@ namespace QuantLib {
                     }
                 }
                 if (next20th != effectiveDate) {
-                    dates_.push_back(next20th);
-                    isRegular_.push_back(*rule_ == DateGeneration::CDS || *rule_ == DateGeneration::CDS2015);
+                    dates.push_back(next20th);
+                    regular.push_back(*rule_ == DateGeneration::CDS || *rule_ == DateGeneration::CDS2015);
                     seed = next20th;
                 }
             }
@@ -311,11 +315,11 @@ namespace QuantLib {
                                                  convention, *endOfMonth_);
                 if (temp > exitDate) {
                     if (nextToLastDate_ != Date() &&
-                        (calendar_.adjust(dates_.back(),convention)!=
+                        (calendar_.adjust(dates.back(),convention)!=
                          calendar_.adjust(nextToLastDate_,convention))) {
-                        dates_.push_back(nextToLastDate_);
-                        isRegular_.push_back(
-                            nullCalendar.advance(dates_[dates_.size()-2],
+                        dates.push_back(nextToLastDate_);
+                        regular.push_back(
+                            nullCalendar.advance(dates[dates.size()-2],
                                 1*(*tenor_), convention, *endOfMonth_) ==
                             nextToLastDate_);
                     }
@@ -323,27 +327,27 @@ namespace QuantLib {
                 } else {
                     // skip dates that would result in duplicates
                     // after adjustment
-                    if (calendar_.adjust(dates_.back(),convention)!=
+                    if (calendar_.adjust(dates.back(),convention)!=
                         calendar_.adjust(temp,convention)) {
-                        dates_.push_back(temp);
-                        isRegular_.push_back(true);
+                        dates.push_back(temp);
+                        regular.push_back(true);
                     }
                     ++periods;
                 }
             }
 
-            if (calendar_.adjust(dates_.back(),terminationDateConvention)!=
+            if (calendar_.adjust(dates.back(),terminationDateConvention)!=
                 calendar_.adjust(terminationDate,terminationDateConvention)) {
                 if (*rule_ == DateGeneration::Twentieth ||
                     *rule_ == DateGeneration::TwentiethIMM ||
                     *rule_ == DateGeneration::OldCDS ||
                     *rule_ == DateGeneration::CDS ||
                     *rule_ == DateGeneration::CDS2015) {
-                    dates_.push_back(nextTwentieth(terminationDate, *rule_));
-                    isRegular_.push_back(true);
+                    dates.push_back(nextTwentieth(terminationDate, *rule_));
+                    regular.push_back(true);
                 } else {
-                    dates_.push_back(terminationDate);
-                    isRegular_.push_back(false);
+                    dates.push_back(terminationDate);
+                    regular.push_back(false);
                 }
             }
 
@@ -355,17 +359,17 @@ namespace QuantLib {
 
         // adjustments
         if (*rule_==DateGeneration::ThirdWednesday)
-            for (Size i=1; i<dates_.size()-1; ++i)
-                dates_[i] = Date::nthWeekday(3, Wednesday,
-                                             dates_[i].month(),
-                                             dates_[i].year());
+            for (Size i=1; i<dates.size()-1; ++i)
+                dates[i] = Date::nthWeekday(3, Wednesday,
+                                             dates[i].month(),
+                                             dates[i].year());
         else if (*rule_ == DateGeneration::ThirdWednesdayInclusive)
-            for (auto& date : dates_)
+            for (auto& date : dates)
                 date = Date::nthWeekday(3, Wednesday, date.month(), date.year());
 
         // first date not adjusted for old CDS schedules
         if (convention != Unadjusted && *rule_ != DateGeneration::OldCDS)
-            dates_.front() = calendar_.adjust(dates_.front(), convention);
+            dates.front() = calendar_.adjust(dates.front(), convention);
 
         // termination date is NOT adjusted as per ISDA
         // specifications, unless otherwise specified in the
@@ -374,43 +378,43 @@ namespace QuantLib {
         if (terminationDateConvention != Unadjusted 
             && *rule_ != DateGeneration::CDS 
             && *rule_ != DateGeneration::CDS2015) {
-            dates_.back() = calendar_.adjust(dates_.back(), 
+            dates.back() = calendar_.adjust(dates.back(), 
                                              terminationDateConvention);
         }
 
         if (*endOfMonth_ && calendar_.isEndOfMonth(seed)) {
             // adjust to end of month
-            for (Size i=1; i<dates_.size()-1; ++i)
-                dates_[i] = calendar_.adjust(Date::endOfMonth(dates_[i]), convention);
+            for (Size i=1; i<dates.size()-1; ++i)
+                dates[i] = calendar_.adjust(Date::endOfMonth(dates[i]), convention);
         } else {
-            for (Size i=1; i<dates_.size()-1; ++i)
-                dates_[i] = calendar_.adjust(dates_[i], convention);
+            for (Size i=1; i<dates.size()-1; ++i)
+                dates[i] = calendar_.adjust(dates[i], convention);
         }
 
         // Final safety checks to remove extra next-to-last date, if
         // necessary.  It can happen to be equal or later than the end
         // date due to EOM adjustments (see the Schedule test suite
         // for an example).
-        if (dates_.size() >= 2 && dates_[dates_.size()-2] >= dates_.back()) {
-            // there might be two dates only, then isRegular_ has size one
-            if (isRegular_.size() >= 2) {
-                isRegular_[isRegular_.size() - 2] =
-                    (dates_[dates_.size() - 2] == dates_.back());
+        if (dates.size() >= 2 && dates[dates.size()-2] >= dates.back()) {
+            // there might be two dates only, then regular has size one
+            if (regular.size() >= 2) {
+                regular[regular.size() - 2] =
+                    (dates[dates.size() - 2] == dates.back());
             }
-            dates_[dates_.size() - 2] = dates_.back();
-            dates_.pop_back();
-            isRegular_.pop_back();
+            dates[dates.size() - 2] = dates.back();
+            dates.pop_back();
+            regular.pop_back();
         }
-        if (dates_.size() >= 2 && dates_[1] <= dates_.front()) {
-            isRegular_[1] =
-                (dates_[1] == dates_.front());
-            dates_[1] = dates_.front();
-            dates_.erase(dates_.begin());
-            isRegular_.erase(isRegular_.begin());
+        if (dates.size() >= 2 && dates[1] <= dates.front()) {
+            regular[1] =
+                (dates[1] == dates.front());
+            dates[1] = dates.front();
+            dates.erase(dates.begin());
+            regular.erase(regular.begin());
         }
 
-        QL_ENSURE(dates_.size()>1,
-            "degenerate single date (" << dates_[0] << ") schedule" <<
+        QL_ENSURE(dates.size()>1,
+            "degenerate single date (" << dates[0] << ") schedule" <<
             "\n seed date: " << seed <<
             "\n exit date: " << exitDate <<
             "\n effective date: " << effectiveDate <<
@@ -419,27 +423,31 @@ namespace QuantLib {
             "\n termination date: " << terminationDate <<
             "\n generation rule: " << *rule_ <<
             "\n end of month: " << *endOfMonth_);
+
+        data_ = ext::make_shared<const Data>(Data{std::move(dates), std::move(regular)});
     }
 
     Schedule Schedule::after(const Date& truncationDate) const {
         Schedule result = *this;
+        std::vector<Date> dates = data_->dates;
+        std::vector<bool> regular = data_->isRegular;
 
-        QL_REQUIRE(truncationDate < result.dates_.back(),
+        QL_REQUIRE(truncationDate < dates.back(),
             "truncation date " << truncationDate <<
             " must be before the last schedule date " <<
-            result.dates_.back());
-        if (truncationDate > result.dates_[0]) {
+            dates.back());
+        if (truncationDate > dates[0]) {
             // remove earlier dates
-            while (result.dates_[0] < truncationDate) {
-                result.dates_.erase(result.dates_.begin());
-                if (!result.isRegular_.empty())
-                    result.isRegular_.erase(result.isRegular_.begin());
+            while (dates[0] < truncationDate) {
+                dates.erase(dates.begin());
+                if (!regular.empty())
+                    regular.erase(regular.begin());
             }
 
             // add truncationDate if missing
-            if (truncationDate != result.dates_.front()) {
-                result.dates_.insert(result.dates_.begin(), truncationDate);
-                result.isRegular_.insert(result.isRegular_.begin(), false);
+            if (truncationDate != dates.front()) {
+                dates.insert(dates.begin(), truncationDate);
+                regular.insert(regular.begin(), false);
                 result.terminationDateConvention_ = Unadjusted;
             }
             else {
@@ -452,28 +460,31 @@ namespace QuantLib {
                 result.firstDate_ = Date();
         }
 
+        result.data_ = ext::make_shared<const Data>(Data{std::move(dates), std::move(regular)});
         return result;
     }
 
     Schedule Schedule::until(const Date& truncationDate) const {
         Schedule result = *this;
+        std::vector<Date> dates = data_->dates;
+        std::vector<bool> regular = data_->isRegular;
 
-        QL_REQUIRE(truncationDate>result.dates_[0],
+        QL_REQUIRE(truncationDate>dates[0],
                    "truncation date " << truncationDate <<
                    " must be later than schedule first date " <<
-                   result.dates_[0]);
-        if (truncationDate<result.dates_.back()) {
+                   dates[0]);
+        if (truncationDate<dates.back()) {
             // remove later dates
-            while (result.dates_.back()>truncationDate) {
-                result.dates_.pop_back();
-                if(!result.isRegular_.empty())
-                    result.isRegular_.pop_back();
+            while (dates.back()>truncationDate) {
+                dates.pop_back();
+                if(!regular.empty())
+                    regular.pop_back();
             }
 
             // add truncationDate if missing
-            if (truncationDate!=result.dates_.back()) {
-                result.dates_.push_back(truncationDate);
-                result.isRegular_.push_back(false);
+            if (truncationDate!=dates.back()) {
+                dates.push_back(truncationDate);
+                regular.push_back(false);
                 result.terminationDateConvention_ = Unadjusted;
             } else {
                 result.terminationDateConvention_ = convention_;
@@ -485,6 +496,7 @@ namespace QuantLib {
                 result.firstDate_ = Date();
         }
 
+        result.data_ = ext::make_shared<const Data>(Data{std::move(dates), std::move(regular)});
         return result;
     }
 
@@ -493,12 +505,12 @@ namespace QuantLib {
         Date d = (refDate==Date() ?
                   Settings::instance().evaluationDate() :
                   refDate);
-        return std::lower_bound(dates_.begin(), dates_.end(), d);
+        return std::lower_bound(data_->dates.begin(), data_->dates.end(), d);
     }
 
     Date Schedule::nextDate(const Date& refDate) const {
         auto res = lower_bound(refDate);
-        if (res!=dates_.end())
+        if (res!=data_->dates.end())
             return *res;
         else
             return {};
@@ -506,28 +518,65 @@ namespace QuantLib {
 
     Date Schedule::previousDate(const Date& refDate) const {
         auto res = lower_bound(refDate);
-        if (res!=dates_.begin())
+        if (res!=data_->dates.begin())
             return *(--res);
         else
             return {};
     }
 
-    bool Schedule::hasIsRegular() const { return !isRegular_.empty(); }
+    bool Schedule::hasIsRegular() const { return !data_->isRegular.empty(); }
 
     bool Schedule::isRegular(Size i) const {
         QL_REQUIRE(hasIsRegular(),
                    "full interface (isRegular) not available");
-        QL_REQUIRE(i<=isRegular_.size() && i>0,
+        QL_REQUIRE(i<=data_->isRegular.size() && i>0,
                    "index (" << i << ") must be in [1, " <<
-                   isRegular_.size() <<"]");
-        return isRegular_[i-1];
+                   data_->isRegular.size() <<"]");
+        return data_->isRegular[i-1];
     }
 
     const std::vector<bool>& Schedule::isRegular() const {
-        QL_REQUIRE(!isRegular_.empty(), "full interface (isRegular) not available");
-        return isRegular_;
+        QL_REQUIRE(!data_->isRegular.empty(), "full interface (isRegular) not available");
+        return data_->isRegular;
     }
 
+    const ext::shared_ptr<const Schedule::Data>& Schedule::emptyData() {
+        static const ext::shared_ptr<const Data> empty = ext::make_shared<const Data>();
+        return empty;
+    }
+
+    Schedule ScheduleCache::schedule(const Date& effectiveDate,
+                                     const Date& terminationDate,
+                                     const Period& tenor,
+                                     const Calendar& calendar,
+                                     BusinessDayConvention convention,
+                                     BusinessDayConvention terminationDateConvention,
+                                     DateGeneration::Rule rule,
+                                     bool endOfMonth,
+                                     const Date& firstDate,
+                                     const Date& nextToLastDate) {
+        // a null effective date is replaced by one depending on the
+        // evaluation date, so the resulting schedule is not stored
+        if (effectiveDate == Date())
+            return Schedule(effectiveDate, terminationDate, tenor, calendar,
+                            convention, terminationDateConvention, rule,
+                            endOfMonth, firstDate, nextToLastDate);
+
+        key_type key(effectiveDate, terminationDate, tenor.length(), tenor.units(),
+                     calendar.empty() ? std::string() : calendar.name(),
+                     convention, terminationDateConvention, rule, endOfMonth,
+                     firstDate, nextToLastDate);
+        auto i = schedules_.find(key);
+        if (i == schedules_.end()) {
+            Schedule s(effectiveDate, terminationDate, tenor, calendar,
+                       convention, terminationDateConvention, rule,
+                       endOfMonth, firstDate, nextToLastDate);
+            i = schedules_.emplace(std::move(key), std::move(s)).first;
+        }
+        return i->second;
+    }
+
+
     MakeSchedule& MakeSchedule::from(const Date& effectiveDate) {
         effectiveDate_ = effectiveDate;
         return *this;
@@ -594,6 +643,11 @@ namespace QuantLib {
         return *this;
     }
 
+    MakeSchedule& MakeSchedule::withCache(ScheduleCache& cache) {
+        cache_ = &cache;
+        return *this;
+    }
+
     MakeSchedule::operator Schedule() const {
         // check for mandatory arguments
         QL_REQUIRE(effectiveDate_ != Date(), "effective date not provided");
@@ -631,6 +685,11 @@ namespace QuantLib {
             calendar = NullCalendar();
         }
 
+        if (cache_ != nullptr)
+            return cache_->schedule(effectiveDate_, terminationDate_, *tenor_, calendar,
+                                    convention, terminationDateConvention,
+                                    rule_, endOfMonth_, firstDate_, nextToLastDate_);
+
         return Schedule(effectiveDate_, terminationDate_, *tenor_, calendar,
                         convention, terminationDateConvention,
                         rule_, endOfMonth_, firstDate_, nextToLastDate_);
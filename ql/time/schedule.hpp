@@ -32,6 +32,9 @@
 #include <ql/time/dategenerationrule.hpp>
 #include <ql/errors.hpp>
 #include <ql/optional.hpp>
+#include <map>
+#include <string>
+#include <tuple>
 
 namespace QuantLib {
 
@@ -66,12 +69,12 @@ namespace QuantLib {
         Schedule() = default;
         //! \name Element access
         //@{
-        Size size() const { return dates_.size(); }
+        Size size() const { return data_->dates.size(); }
         const Date& operator[](Size i) const;
         const Date& at(Size i) const;
         const Date& date(Size i) const;
-        const std::vector<Date>& dates() const { return dates_; }
-        bool empty() const { return dates_.empty(); }
+        const std::vector<Date>& dates() const { return data_->dates; }
+        bool empty() const { return data_->dates.empty(); }
         const Date& front() const;
         const Date& back() const;
         //@}
@@ -98,8 +101,8 @@ namespace QuantLib {
         //! \name Iterators
         //@{
         typedef std::vector<Date>::const_iterator const_iterator;
-        const_iterator begin() const { return dates_.begin(); }
-        const_iterator end() const { return dates_.end(); }
+        const_iterator begin() const { return data_->dates.begin(); }
+        const_iterator end() const { return data_->dates.end(); }
         const_iterator lower_bound(const Date& d = Date()) const;
         //@}
         //! \name Utilities
@@ -116,8 +119,49 @@ namespace QuantLib {
         ext::optional<DateGeneration::Rule> rule_;
         ext::optional<bool> endOfMonth_;
         Date firstDate_, nextToLastDate_;
-        std::vector<Date> dates_;
-        std::vector<bool> isRegular_;
+        // dates and regularity don't change once the schedule is
+        // built, so that copies of the schedule can share them
+        struct Data {
+            std::vector<Date> dates;
+            std::vector<bool> isRegular;
+        };
+        ext::shared_ptr<const Data> data_ = emptyData();
+        static const ext::shared_ptr<const Data>& emptyData();
+    };
+
+
+    //! Cache of rule-based schedules
+    /*! Schedules with the same dates and conventions are only
+        generated once; afterwards, the cache returns copies sharing
+        the same dates.  This saves both time and memory when many
+        instruments (e.g., a book of swaps) are built on a limited
+        number of distinct schedules.
+
+        Calendars are identified by name; the cache should be cleared
+        when holidays are added to or removed from a calendar in use.
+
+        \warning this class is not thread-safe.
+    */
+    class ScheduleCache {
+      public:
+        Schedule schedule(const Date& effectiveDate,
+                          const Date& terminationDate,
+                          const Period& tenor,
+                          const Calendar& calendar,
+                          BusinessDayConvention convention,
+                          BusinessDayConvention terminationDateConvention,
+                          DateGeneration::Rule rule,
+                          bool endOfMonth,
+                          const Date& firstDate = Date(),
+                          const Date& nextToLastDate = Date());
+        //! number of distinct schedules stored
+        Size size() const { return schedules_.size(); }
+        void clear() { schedules_.clear(); }
+      private:
+        typedef std::tuple<Date, Date, Integer, TimeUnit, std::string,
+                           BusinessDayConvention, BusinessDayConvention,
+                           DateGeneration::Rule, bool, Date, Date> key_type;
+        std::map<key_type, Schedule> schedules_;
     };
 
 
@@ -140,6 +184,8 @@ namespace QuantLib {
         MakeSchedule& endOfMonth(bool flag=true);
         MakeSchedule& withFirstDate(const Date& d);
         MakeSchedule& withNextToLastDate(const Date& d);
+        //! retrieves the schedule from (or stores it in) the given cache
+        MakeSchedule& withCache(ScheduleCache& cache);
         operator Schedule() const;
       private:
         Calendar calendar_;
@@ -150,6 +196,7 @@ namespace QuantLib {
         DateGeneration::Rule rule_ = DateGeneration::Backward;
         bool endOfMonth_ = false;
         Date firstDate_, nextToLastDate_;
+        ScheduleCache* cache_ = nullptr;
     };
 
     /*! Helper function for returning the date on or before date \p d that is the 20th of the month and obeserves the 
@@ -163,29 +210,29 @@ namespace QuantLib {
     // inline definitions
 
     inline const Date& Schedule::date(Size i) const {
-        return dates_.at(i);
+        return data_->dates.at(i);
     }
 
     inline const Date& Schedule::operator[](Size i) const {
         #if defined(QL_EXTRA_SAFETY_CHECKS)
-        return dates_.at(i);
+        return data_->dates.at(i);
         #else
-        return dates_[i];
+        return data_->dates[i];
         #endif
     }
 
     inline const Date& Schedule::at(Size i) const {
-        return dates_.at(i);
+        return data_->dates.at(i);
     }
 
     inline const Date& Schedule::front() const {
-        QL_REQUIRE(!dates_.empty(), "no front date for empty schedule");
-        return dates_.front();
+        QL_REQUIRE(!data_->dates.empty(), "no front date for empty schedule");
+        return data_->dates.front();
     }
 
     inline const Date& Schedule::back() const {
-        QL_REQUIRE(!dates_.empty(), "no back date for empty schedule");
-        return dates_.back();
+        QL_REQUIRE(!data_->dates.empty(), "no back date for empty schedule");
+        return data_->dates.back();
     }
 
     inline const Calendar& Schedule::calendar() const {
@@ -193,14 +240,14 @@ namespace QuantLib {
     }
 
     inline const Date& Schedule::startDate() const {
-        QL_REQUIRE(!dates_.empty(), "empty Schedule: no start date"); 
-        return dates_.front();
+        QL_REQUIRE(!data_->dates.empty(), "empty Schedule: no start date"); 
+        return data_->dates.front();
     }
 
     inline const Date &Schedule::endDate() const {
         // Checks to avoid segfault, issue #2302
-        QL_REQUIRE(!dates_.empty(), "empty Schedule: no end date"); 
-        return dates_.back(); 
+        QL_REQUIRE(!data_->dates.empty(), "empty Schedule: no end date"); 
+        return data_->dates.back(); 
     }
 
     inline bool Schedule::hasTenor() const {
@@ -859,6 +859,7 @@ BOOST_AUTO_TEST_CASE(testDifferentOptimizers) {
 
     const ext::shared_ptr<OptimizationMethod> optimizationMethods[] = {
         ext::make_shared<LevenbergMarquardt>(),
+        ext::make_shared<LevenbergMarquardt>(1e-8, 1e-8, 1e-8, true),
         ext::make_shared<BFGS>(),
         ext::make_shared<Simplex>(0.2)
     };
@@ -1057,6 +1058,147 @@ BOOST_AUTO_TEST_CASE(testAndreasenHugeVolatilityAdapterAtmLevel) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testLocalVolGrid) {
+    BOOST_TEST_MESSAGE(
+        "Testing Andreasen-Huge local volatility on a precomputed grid...");
+
+    const CalibrationData data = AndreasenHugeExampleData();
+    Settings::instance().evaluationDate() = data.rTS->referenceDate();
+
+    const auto interpl = ext::make_shared<AndreasenHugeVolatilityInterpl>(
+        data.calibrationSet, data.spot, data.rTS, data.qTS,
+        AndreasenHugeVolatilityInterpl::CubicSpline,
+        AndreasenHugeVolatilityInterpl::Call);
+
+    const std::vector<Time> gridTimes = { 0.1, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0 };
+
+    const AndreasenHugeLocalVolAdapter localVol(interpl);
+    const AndreasenHugeLocalVolAdapter gridLocalVol(interpl, gridTimes, 2000);
+
+    const Real s0 = data.spot->value();
+    const Real tol = 2e-3;
+    for (Size i=0; i < gridTimes.size(); ++i) {
+        const Time t = gridTimes[i];
+        for (Real strike = 0.5*s0; strike < 1.5*s0; strike += 0.05*s0) {
+            const Volatility expected = localVol.localVol(t, strike, true);
+            const Volatility calculated = gridLocalVol.localVol(t, strike, true);
+
+            if (std::fabs(calculated - expected) > tol)
+                BOOST_FAIL("failed to reproduce local volatility on grid"
+                           << "\n    time:       " << t
+                           << "\n    strike:     " << strike
+                           << "\n    calculated: " << calculated
+                           << "\n    expected:   " << expected
+                           << "\n    tolerance:  " << tol);
+
+            if (i > 0) {
+                const Time tm = 0.5*(t + gridTimes[i-1]);
+                const Volatility expectedMid = 0.5*(
+                    calculated + gridLocalVol.localVol(gridTimes[i-1], strike, true));
+                const Volatility calculatedMid =
+                    gridLocalVol.localVol(tm, strike, true);
+
+                if (std::fabs(calculatedMid - expectedMid) > 1e-10)
+                    BOOST_FAIL("failed to interpolate local volatility in time"
+                               << "\n    time:       " << tm
+                               << "\n    strike:     " << strike
+                               << "\n    calculated: " << calculatedMid
+                               << "\n    expected:   " << expectedMid);
+            }
+        }
+    }
+
+    // the grid is rebuilt when the market data change
+    const auto quote = ext::dynamic_pointer_cast<SimpleQuote>(
+        data.calibrationSet[0].second);
+    quote->setValue(quote->value() + 0.01);
+    const Volatility expected = localVol.localVol(0.1, s0, true);
+    const Volatility calculated = gridLocalVol.localVol(0.1, s0, true);
+    if (std::fabs(calculated - expected) > tol)
+        BOOST_FAIL("failed to update local volatility grid"
+                   << "\n    calculated: " << calculated
+                   << "\n    expected:   " << expected);
+
+    // the grid is only rebuilt on lookup, so that a failing
+    // calibration doesn't prevent the market data from changing
+    const Real previous = quote->value();
+    BOOST_CHECK_NO_THROW(quote->setValue(Null<Real>()));
+    BOOST_CHECK_THROW(gridLocalVol.localVol(0.1, s0, true), Error);
+    BOOST_CHECK_NO_THROW(quote->setValue(previous));
+    BOOST_CHECK_CLOSE(gridLocalVol.localVol(0.1, s0, true), calculated, 1e-10);
+}
+
+class JacobianCheckingOptimizer : public OptimizationMethod {
+  public:
+    EndCriteria::Type minimize(Problem& P, const EndCriteria& endCriteria) override {
+        const EndCriteria::Type type =
+            LevenbergMarquardt(1e-8, 1e-8, 1e-8, true).minimize(P, endCriteria);
+
+        // compare at the calibrated and at a perturbed volatility vector
+        const Array sig = P.currentValue();
+        check(P.costFunction(), sig);
+        Array perturbed(sig);
+        for (Size i=0; i < perturbed.size(); ++i)
+            perturbed[i] *= 1.0 + 0.05*std::sin(Real(i+1));
+        check(P.costFunction(), perturbed);
+
+        return type;
+    }
+
+    Real maxError = 0.0;
+
+  private:
+    void check(const CostFunction& costFunction, const Array& sig) {
+        const Array values = costFunction.values(sig);
+        Matrix jac(values.size(), sig.size());
+        costFunction.jacobian(jac, sig);
+
+        for (Size j=0; j < sig.size(); ++j) {
+            const Real h = 1e-6*sig[j];
+            Array sigUp(sig), sigDown(sig);
+            sigUp[j] += h;
+            sigDown[j] -= h;
+            const Array fd =
+                (costFunction.values(sigUp) - costFunction.values(sigDown))/(2*h);
+            for (Size i=0; i < values.size(); ++i)
+                maxError = std::max(maxError,
+                    std::fabs(jac[i][j] - fd[i])/(1.0 + std::fabs(fd[i])));
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(testAnalyticJacobian) {
+    BOOST_TEST_MESSAGE(
+        "Testing analytic Jacobian of the Andreasen-Huge "
+        "calibration against finite differences...");
+
+    const CalibrationData data = sabrData().first;
+    Settings::instance().evaluationDate() = data.rTS->referenceDate();
+
+    const AndreasenHugeVolatilityInterpl::CalibrationType calibrationTypes[] = {
+        AndreasenHugeVolatilityInterpl::Call,
+        AndreasenHugeVolatilityInterpl::Put,
+        AndreasenHugeVolatilityInterpl::CallPut
+    };
+
+    const Real tol = 1e-5;
+    for (auto calibrationType : calibrationTypes) {
+        const auto optimizer = ext::make_shared<JacobianCheckingOptimizer>();
+
+        AndreasenHugeVolatilityInterpl(
+            data.calibrationSet, data.spot, data.rTS, data.qTS,
+            AndreasenHugeVolatilityInterpl::CubicSpline,
+            calibrationType, 400, Null<Real>(), Null<Real>(),
+            optimizer).calibrationError();
+
+        if (optimizer->maxError > tol)
+            BOOST_FAIL("failed to reproduce the finite difference Jacobian"
+                       << "\n    calibration type: " << calibrationType
+                       << "\n    max deviation:    " << optimizer->maxError
+                       << "\n    tolerance:        " << tol);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
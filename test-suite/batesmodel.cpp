@@ -34,6 +34,7 @@
 #include <ql/pricingengines/vanilla/analyticeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/mceuropeanhestonengine.hpp>
 #include <ql/pricingengines/vanilla/fdbatesvanillaengine.hpp>
+#include <ql/pricingengines/vanilla/ffthestonengine.hpp>
 #include <ql/models/equity/batesmodel.hpp>
 #include <ql/models/equity/hestonmodelhelper.hpp>
 #include <ql/time/period.hpp>
@@ -359,6 +360,123 @@ BOOST_AUTO_TEST_CASE(testAnalyticVsMCPricing) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testFFTEngines) {
+    BOOST_TEST_MESSAGE("Testing FFT Heston and Bates engines "
+                       "against analytic engines...");
+
+    Date settlementDate(30, March, 2007);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    DayCounter dayCounter = ActualActual(ActualActual::ISDA);
+
+    const Period maturities[] = { 3*Months, 1*Years, 5*Years };
+    const Real strikes[] = { 60.0, 80.0, 95.0, 100.0, 105.0, 120.0, 150.0 };
+    const Option::Type types[] = { Option::Call, Option::Put };
+
+    const Real tolerance = 1e-2;
+
+    for (auto& hestonModel : hestonModels) {
+        Handle<YieldTermStructure> riskFreeTS(flatRate(hestonModel.r, dayCounter));
+        Handle<YieldTermStructure> dividendTS(flatRate(hestonModel.q, dayCounter));
+        Handle<Quote> s0(ext::shared_ptr<Quote>(new SimpleQuote(100)));
+
+        ext::shared_ptr<HestonModel> hestonModelPtr(new HestonModel(
+            ext::make_shared<HestonProcess>(
+                riskFreeTS, dividendTS, s0, hestonModel.v0, hestonModel.kappa,
+                hestonModel.theta, hestonModel.sigma, hestonModel.rho)));
+        ext::shared_ptr<BatesModel> batesModel(new BatesModel(
+            ext::make_shared<BatesProcess>(
+                riskFreeTS, dividendTS, s0, hestonModel.v0, hestonModel.kappa,
+                hestonModel.theta, hestonModel.sigma, hestonModel.rho,
+                1.5, -0.15, 0.1)));
+
+        const ext::shared_ptr<PricingEngine> analyticEngines[] = {
+            ext::make_shared<AnalyticHestonEngine>(hestonModelPtr, 160),
+            ext::make_shared<BatesEngine>(batesModel, 160)
+        };
+        const ext::shared_ptr<FFTEngine> fftEngines[] = {
+            ext::make_shared<FFTHestonEngine>(hestonModelPtr),
+            ext::make_shared<FFTBatesEngine>(batesModel)
+        };
+        const std::string names[] = { "Heston", "Bates" };
+
+        std::vector<ext::shared_ptr<Instrument> > options;
+        for (const auto& maturity : maturities) {
+            ext::shared_ptr<Exercise> exercise =
+                ext::make_shared<EuropeanExercise>(settlementDate + maturity);
+            for (Real strike : strikes)
+                for (auto type : types)
+                    options.push_back(ext::make_shared<VanillaOption>(
+                        ext::make_shared<PlainVanillaPayoff>(type, strike), exercise));
+        }
+
+        for (Size j=0; j<2; ++j) {
+            // first pass: one option at a time, using the call prices
+            // cached per expiry; second pass: precalculated results
+            for (Size pass=0; pass<2; ++pass) {
+                if (pass == 1)
+                    fftEngines[j]->precalculate(options);
+
+                for (const auto& instrument : options) {
+                    ext::shared_ptr<VanillaOption> option =
+                        ext::dynamic_pointer_cast<VanillaOption>(instrument);
+
+                    option->setPricingEngine(analyticEngines[j]);
+                    const Real expected = option->NPV();
+                    option->setPricingEngine(fftEngines[j]);
+                    const Real calculated = option->NPV();
+
+                    const Real error = std::fabs(calculated - expected);
+                    if (error > tolerance) {
+                        ext::shared_ptr<StrikedTypePayoff> payoff =
+                            ext::dynamic_pointer_cast<StrikedTypePayoff>(
+                                                            option->payoff());
+                        BOOST_ERROR("failed to reproduce analytic price with FFT "
+                                    << names[j] << " engine"
+                                    << "\n    parameter:  " << hestonModel.name
+                                    << "\n    type:       " << payoff->optionType()
+                                    << "\n    strike:     " << payoff->strike()
+                                    << "\n    maturity:   "
+                                    << option->exercise()->lastDate()
+                                    << std::fixed << std::setprecision(8)
+                                    << "\n    calculated: " << calculated
+                                    << "\n    expected:   " << expected
+                                    << "\n    error:      " << error
+                                    << "\n    tolerance:  " << tolerance);
+                    }
+                }
+            }
+        }
+
+        // changing the model must invalidate the cached prices
+        Array params = hestonModelPtr->params();
+        params[3] = 0.0;
+        hestonModelPtr->setParams(params);
+
+        for (const auto& instrument : options) {
+            ext::shared_ptr<VanillaOption> option =
+                ext::dynamic_pointer_cast<VanillaOption>(instrument);
+
+            option->setPricingEngine(analyticEngines[0]);
+            const Real expected = option->NPV();
+            option->setPricingEngine(fftEngines[0]);
+            const Real calculated = option->NPV();
+
+            const Real error = std::fabs(calculated - expected);
+            if (error > tolerance) {
+                BOOST_ERROR("failed to reproduce analytic price with FFT "
+                            "Heston engine after a model change"
+                            << "\n    parameter:  " << hestonModel.name
+                            << std::fixed << std::setprecision(8)
+                            << "\n    calculated: " << calculated
+                            << "\n    expected:   " << expected
+                            << "\n    error:      " << error
+                            << "\n    tolerance:  " << tolerance);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testDAXCalibration) {
     /* this example is taken from A. Sepp
        Pricing European-Style Options under Jump Diffusion Processes
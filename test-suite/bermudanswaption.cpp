@@ -32,6 +32,7 @@
 #include <ql/models/shortrate/twofactormodels/g2.hpp>
 #include <ql/pricingengines/swap/discountingswapengine.hpp>
 #include <ql/pricingengines/swaption/fdg2swaptionengine.hpp>
+#include <ql/pricingengines/swaption/discretizedswaption.hpp>
 #include <ql/pricingengines/swaption/fdhullwhiteswaptionengine.hpp>
 #include <ql/pricingengines/swaption/treeswaptionengine.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
@@ -235,6 +236,78 @@ BOOST_AUTO_TEST_CASE(testCachedValues) {
                     << "expected:   " << otmValue);
 }
 
+BOOST_AUTO_TEST_CASE(testJointTreeValuation) {
+
+    BOOST_TEST_MESSAGE(
+        "Testing joint valuation of swaptions on a shared tree...");
+
+    CommonVars vars;
+
+    vars.today = Date(15, February, 2002);
+    Settings::instance().evaluationDate() = vars.today;
+    vars.settlement = Date(19, February, 2002);
+    vars.termStructure.linkTo(flatRate(vars.settlement,
+                                       0.04875825,
+                                       Actual365Fixed()));
+
+    Rate atmRate = vars.makeSwap(0.0)->fairRate();
+
+    ext::shared_ptr<VanillaSwap> atmSwap = vars.makeSwap(atmRate);
+    std::vector<Date> exerciseDates;
+    for (const auto& cf : atmSwap->fixedLeg()) {
+        auto coupon = ext::dynamic_pointer_cast<Coupon>(cf);
+        exerciseDates.push_back(coupon->accrualStartDate());
+    }
+    std::vector<Date> earlierDates;
+    for (const auto& d : exerciseDates)
+        earlierDates.push_back(vars.calendar.adjust(d - 10));
+
+    // different strikes, exercise schedules and last exercise times
+    std::vector<ext::shared_ptr<Exercise>> exercises = {
+        ext::make_shared<BermudanExercise>(exerciseDates),
+        ext::make_shared<BermudanExercise>(earlierDates),
+        ext::make_shared<EuropeanExercise>(exerciseDates.front()),
+        ext::make_shared<BermudanExercise>(
+            std::vector<Date>(exerciseDates.begin(), exerciseDates.end() - 2))
+    };
+    std::vector<ext::shared_ptr<Swaption>> swaptions;
+    for (Real moneyness : { 0.8, 1.0, 1.2 })
+        for (const auto& exercise : exercises)
+            swaptions.push_back(ext::make_shared<Swaption>(
+                vars.makeSwap(moneyness*atmRate), exercise));
+
+    auto model = ext::make_shared<HullWhite>(vars.termStructure,
+                                             0.048696, 0.0058904);
+
+    std::vector<Time> times;
+    for (const auto& s : swaptions) {
+        Swaption::arguments arguments;
+        s->setupArguments(&arguments);
+        DiscretizedSwaption discretized(arguments,
+                                        vars.termStructure->referenceDate(),
+                                        vars.termStructure->dayCounter());
+        std::vector<Time> t = discretized.mandatoryTimes();
+        times.insert(times.end(), t.begin(), t.end());
+    }
+    TimeGrid grid(times.begin(), times.end(), 50);
+
+    std::vector<Real> values = treeSwaptionValues(swaptions, model, grid);
+
+    auto engine = ext::make_shared<TreeSwaptionEngine>(model, grid);
+    Real tolerance = 1.0e-8;
+    for (Size i=0; i<swaptions.size(); ++i) {
+        swaptions[i]->setPricingEngine(engine);
+        Real expected = swaptions[i]->NPV();
+        if (std::fabs(values[i]-expected) > tolerance)
+            BOOST_ERROR("failed to reproduce swaption value "
+                        "with joint rollback:"
+                        << std::setprecision(10)
+                        << "\n    swaption:   " << i
+                        << "\n    calculated: " << values[i]
+                        << "\n    expected:   " << expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testCachedG2Values) {
     BOOST_TEST_MESSAGE(
         "Testing Bermudan swaption with G2 model against cached values...");
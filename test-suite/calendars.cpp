@@ -3659,6 +3659,103 @@ BOOST_AUTO_TEST_CASE(testBusinessDaysBetween) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testPrecomputedBusinessDays) {
+
+    BOOST_TEST_MESSAGE("Testing precomputed business days...");
+
+    // joint calendars have their own implementation, so that the
+    // precomputed days don't leak into the other tests
+    Calendar precomputed = JointCalendar(TARGET(), UnitedKingdom());
+    Calendar reference = JointCalendar(TARGET(), UnitedKingdom());
+    precomputed.precomputeBusinessDays(2024, 2026);
+
+    auto check = [&](const std::string& step) {
+        const Integer shifts[] = { -30, -5, -1, 1, 5, 30 };
+        const Integer spans[] = { -40, -1, 0, 1, 3, 40 };
+        for (Date d(1, December, 2023); d <= Date(31, January, 2027); ++d) {
+            if (precomputed.isBusinessDay(d) != reference.isBusinessDay(d))
+                BOOST_FAIL(step << ": wrong business day check for " << d);
+            for (Integer n : shifts) {
+                Date calculated = precomputed.advance(d, n, Days);
+                Date expected = reference.advance(d, n, Days);
+                if (calculated != expected)
+                    BOOST_FAIL(step << ": wrong advance of " << n << " days from " << d
+                               << "\n    calculated: " << calculated
+                               << "\n    expected:   " << expected);
+            }
+            for (Integer span : spans) {
+                for (bool includeFirst : { true, false }) {
+                    for (bool includeLast : { true, false }) {
+                        Date::serial_type calculated = precomputed.businessDaysBetween(
+                            d, d + span, includeFirst, includeLast);
+                        Date::serial_type expected = reference.businessDaysBetween(
+                            d, d + span, includeFirst, includeLast);
+                        if (calculated != expected)
+                            BOOST_FAIL(step << ": wrong business days between "
+                                       << d << " and " << d + span
+                                       << "\n    calculated: " << calculated
+                                       << "\n    expected:   " << expected);
+                    }
+                }
+            }
+        }
+    };
+
+    check("initial calendar");
+
+    // a change in the underlying calendars is picked up...
+    Calendar uk = UnitedKingdom();
+    Date ukHoliday(16, June, 2025);
+    if (!precomputed.isBusinessDay(ukHoliday))
+        BOOST_FAIL(ukHoliday << " erroneously detected as holiday");
+    uk.addHoliday(ukHoliday);
+    if (precomputed.isBusinessDay(ukHoliday))
+        BOOST_ERROR(ukHoliday << " not detected as holiday after being added");
+    check("after adding a holiday to an underlying calendar");
+    precomputed.precomputeBusinessDays(2024, 2026);
+    check("after precomputing the business days again");
+    uk.removeHoliday(ukHoliday);
+    if (!precomputed.isBusinessDay(ukHoliday))
+        BOOST_ERROR(ukHoliday << " still detected as holiday after being removed");
+    check("after removing a holiday from an underlying calendar");
+
+    // ...and so are the changes to the calendar itself
+    precomputed.precomputeBusinessDays(2024, 2026);
+    Date holiday(10, March, 2026);
+    precomputed.addHoliday(holiday);
+    reference.addHoliday(holiday);
+    if (precomputed.isBusinessDay(holiday))
+        BOOST_ERROR(holiday << " not detected as holiday after being added");
+    check("after adding a holiday");
+    Date christmas(25, December, 2024);
+    precomputed.removeHoliday(christmas);
+    reference.removeHoliday(christmas);
+    if (!precomputed.isBusinessDay(christmas))
+        BOOST_ERROR(christmas << " still detected as holiday after being removed");
+    check("after removing a holiday");
+    precomputed.addHoliday(christmas);
+    reference.addHoliday(christmas);
+    precomputed.removeHoliday(holiday);
+    reference.removeHoliday(holiday);
+    check("after restoring the original holidays");
+
+    BespokeCalendar bespoke;
+    bespoke.precomputeBusinessDays(2024, 2026);
+    Date saturday(7, March, 2026);
+    if (!bespoke.isBusinessDay(saturday))
+        BOOST_ERROR(saturday << " erroneously detected as holiday");
+    bespoke.addWeekend(Saturday);
+    if (bespoke.isBusinessDay(saturday))
+        BOOST_ERROR(saturday << " (Saturday) not detected as weekend");
+    if (bespoke.advance(Date(6, March, 2026), 1, Days) != Date(8, March, 2026))
+        BOOST_ERROR("wrong advance over added weekend day");
+
+    // don't leave the added or removed holidays to the other tests
+    uk.resetAddedAndRemovedHolidays();
+    precomputed.resetAddedAndRemovedHolidays();
+    reference.resetAddedAndRemovedHolidays();
+}
+
 BOOST_AUTO_TEST_CASE(testBespokeCalendars) {
 
     BOOST_TEST_MESSAGE("Testing bespoke calendars...");
@@ -37,6 +37,9 @@
 #include <boost/mpl/vector.hpp>
 #include <iomanip>
 #include <iostream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -346,6 +349,116 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(testHW, T, dataSets) {
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(testTrancheLossesAtSeveralDates) {
+    BOOST_TEST_MESSAGE("Testing expected tranche losses at several dates...");
+
+    Date asofDate(31, August, 2006);
+    Settings::instance().evaluationDate() = asofDate;
+
+    Size poolSize = 40;
+    Real recovery = 0.4;
+
+    // issuers with different hazard rates
+    ext::shared_ptr<Pool> pool(new Pool());
+    std::vector<std::string> names;
+    for (Size i = 0; i < poolSize; ++i) {
+        Handle<DefaultProbabilityTermStructure> curve(
+            ext::make_shared<FlatHazardRate>(asofDate, 0.005 + 0.0005 * i,
+                                             ActualActual(ActualActual::ISDA)));
+        std::vector<std::pair<DefaultProbKey, Handle<DefaultProbabilityTermStructure>>>
+            probabilities(1, std::make_pair(
+                NorthAmericaCorpDefaultKey(EURCurrency(), SeniorSec, Period(0, Weeks), 10.),
+                curve));
+        std::ostringstream o;
+        o << "issuer-" << i;
+        names.push_back(o.str());
+        pool->add(names.back(), Issuer(probabilities),
+                  NorthAmericaCorpDefaultKey(EURCurrency(), QuantLib::SeniorSec, Period(), 1.));
+    }
+
+    std::vector<Date> dates;
+    for (Size i = 1; i <= 20; ++i)
+        dates.push_back(asofDate + i * 3 * Months);
+
+    Handle<Quote> correlation(ext::make_shared<SimpleQuote>(0.3));
+    auto latentModel = ext::make_shared<GaussianConstantLossLM>(
+        correlation, std::vector<Real>(poolSize, recovery),
+        LatentModelIntegrationType::GaussianQuadrature, poolSize,
+        GaussianCopulaPolicy::initTraits());
+
+    struct {
+        std::string name;
+        ext::shared_ptr<DefaultLossModel> model;
+        std::vector<Real> expected;
+    } models[] = {
+        { "homogeneous",
+          ext::make_shared<HomogGaussPoolLossModel>(latentModel, 200, 5., -5., 50),
+          { 0.893347749588, 2.4354969906, 4.30990578208, 6.35300781811,
+            8.47093662622, 10.6400457823, 12.8590935769, 15.0873800783,
+            17.2871465404, 19.4528699245, 21.6475234561, 23.8151273875,
+            25.9285507235, 27.9859128106, 30.0530698815, 32.0823264826,
+            34.0511604793, 35.960148586, 37.8718833519, 39.7433435175 } },
+        { "inhomogeneous",
+          ext::make_shared<IHGaussPoolLossModel>(latentModel, 200, 5., -5., 50),
+          { 0.91324450513, 2.47532128619, 4.36753662541, 6.42600745824,
+            8.55705088551, 10.7374681841, 12.9663767056, 15.2031647515,
+            17.4101757852, 19.5820763473, 21.7821438731, 23.9543526622,
+            26.0716264976, 28.1321849057, 30.2020493969, 32.2335085882,
+            34.2040777636, 36.1143937343, 38.0271282831, 39.8992641187 } }
+    };
+
+    for (const auto& model : models) {
+        auto basket = ext::make_shared<Basket>(asofDate, names,
+                                               std::vector<Real>(poolSize, 100.0),
+                                               pool, 0.03, 0.06);
+        basket->setLossModel(model.model);
+
+        const std::vector<Real> losses = basket->expectedTrancheLosses(dates);
+
+        for (Size t = 0; t < dates.size(); ++t) {
+            const Real expected = model.expected[t];
+            const Real singleDate = basket->expectedTrancheLoss(dates[t]);
+            if (std::fabs(losses[t] - expected) > 1e-9 * expected)
+                BOOST_ERROR("failed to reproduce tranche loss with "
+                            << model.name << " model"
+                            << "\n    date:       " << dates[t]
+                            << std::setprecision(12)
+                            << "\n    calculated: " << losses[t]
+                            << "\n    expected:   " << expected);
+            if (std::fabs(singleDate - expected) > 1e-9 * expected)
+                BOOST_ERROR("failed to reproduce single-date tranche loss with "
+                            << model.name << " model"
+                            << "\n    date:       " << dates[t]
+                            << std::setprecision(12)
+                            << "\n    calculated: " << singleDate
+                            << "\n    expected:   " << expected);
+        }
+
+        #ifdef _OPENMP
+        // the results must not depend on the number of threads
+        const int maxThreads = omp_get_max_threads();
+        for (int threads : { 1, 2, 3, 8 }) {
+            omp_set_num_threads(threads);
+            const std::vector<Real> calculated = basket->expectedTrancheLosses(dates);
+            for (Size t = 0; t < dates.size(); ++t) {
+                if (calculated[t] != losses[t])
+                    BOOST_ERROR("tranche loss depends on the number of threads with "
+                                << model.name << " model"
+                                << "\n    threads:    " << threads
+                                << "\n    date:       " << dates[t]
+                                << std::setprecision(16)
+                                << "\n    calculated: " << calculated[t]
+                                << "\n    expected:   " << losses[t]);
+            }
+        }
+        omp_set_num_threads(maxThreads);
+        #endif
+    }
+
+    BOOST_CHECK_THROW(HomogGaussPoolLossModel(latentModel, 200, 5., -5., 0), Error);
+    BOOST_CHECK_THROW(IHGaussPoolLossModel(latentModel, 200, 5., -5., 0), Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -459,6 +459,149 @@ BOOST_AUTO_TEST_CASE(testParity) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testReplicationGrid) {
+
+    BOOST_TEST_MESSAGE("Testing CMS coupon pricing on shared replication grids...");
+
+    CommonVars vars;
+
+    std::vector<Handle<SwaptionVolatilityStructure> > swaptionVols = {
+                           vars.atmVol, vars.SabrVolCube1, vars.SabrVolCube2};
+
+    ext::shared_ptr<SwapIndex> swapIndex(new
+        EuriborSwapIsdaFixA(10*Years,
+                            vars.iborIndex->forwardingTermStructure()));
+
+    // legs with the same fixing dates and different caps and floors
+    Date startDate = vars.termStructure->referenceDate() + 1*Years;
+    Schedule schedule(startDate, startDate + 15*Years, 1*Years,
+                      TARGET(), ModifiedFollowing, ModifiedFollowing,
+                      DateGeneration::Forward, false);
+    std::vector<Leg> legs = {
+        CmsLeg(schedule, swapIndex).withNotionals(1.0),
+        CmsLeg(schedule, swapIndex).withNotionals(1.0).withCaps(0.06),
+        CmsLeg(schedule, swapIndex).withNotionals(1.0).withFloors(0.03),
+        CmsLeg(schedule, swapIndex).withNotionals(1.0).withCaps(0.08).withFloors(0.02),
+        CmsLeg(schedule, swapIndex).withNotionals(1.0).withGearings(0.5).withSpreads(0.002)
+    };
+
+    Handle<Quote> meanReversion(ext::make_shared<SimpleQuote>(0.01));
+    for (auto& swaptionVol : swaptionVols) {
+        std::vector<std::pair<ext::shared_ptr<CmsCouponPricer>,
+                              ext::shared_ptr<CmsCouponPricer> > > pricers = {
+            {ext::make_shared<NumericHaganPricer>(swaptionVol, GFunctionFactory::Standard,
+                                                  meanReversion),
+             ext::make_shared<NumericHaganPricer>(swaptionVol, GFunctionFactory::Standard,
+                                                  meanReversion, 0.0, 1.0, 1.0e-6,
+                                                  QL_MAX_REAL, 8)},
+            {ext::make_shared<NumericHaganPricer>(swaptionVol,
+                                                  GFunctionFactory::NonParallelShifts,
+                                                  meanReversion),
+             ext::make_shared<NumericHaganPricer>(swaptionVol,
+                                                  GFunctionFactory::NonParallelShifts,
+                                                  meanReversion, 0.0, 1.0, 1.0e-6,
+                                                  QL_MAX_REAL, 8)},
+            {ext::make_shared<LinearTsrPricer>(swaptionVol, meanReversion),
+             ext::make_shared<LinearTsrPricer>(
+                 swaptionVol, meanReversion, Handle<YieldTermStructure>(),
+                 LinearTsrPricer::Settings().withReplicationGrid())},
+            {ext::make_shared<LinearTsrPricer>(
+                 swaptionVol, meanReversion, Handle<YieldTermStructure>(),
+                 LinearTsrPricer::Settings().withBSStdDevs()),
+             ext::make_shared<LinearTsrPricer>(
+                 swaptionVol, meanReversion, Handle<YieldTermStructure>(),
+                 LinearTsrPricer::Settings().withBSStdDevs().withReplicationGrid())}};
+
+        for (Size k=0; k<pricers.size(); ++k) {
+            bool linearTsr = k > 1;
+            Real tolerance = linearTsr ? 1.0e-6 : 2.0e-5;
+            for (auto& leg : legs) {
+                for (auto& cf : leg) {
+                    auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(cf);
+                    coupon->setPricer(pricers[k].first);
+                    Real expected = coupon->amount();
+                    coupon->setPricer(pricers[k].second);
+                    Real calculated = coupon->amount();
+                    if (std::fabs(calculated - expected) > tolerance)
+                        BOOST_ERROR("failed to reproduce coupon amount on replication grid:"
+                                    << "\n    pricer:     " << k
+                                    << (linearTsr ? " (Linear TSR Model)" : "")
+                                    << "\n    fixing:     " << coupon->fixingDate()
+                                    << "\n    expected:   " << expected
+                                    << "\n    calculated: " << calculated
+                                    << "\n    difference: " << calculated - expected
+                                    << "\n    tolerance:  " << tolerance);
+                }
+            }
+        }
+
+        // the grids are rebuilt when the market moves
+        auto pricer = pricers[2].second;
+        auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(legs[1][5]);
+        coupon->setPricer(pricer);
+        Real before = coupon->amount();
+        vars.termStructure.linkTo(flatRate(vars.termStructure->referenceDate(), 0.06,
+                                           Actual365Fixed()));
+        Real shifted = coupon->amount();
+        coupon->setPricer(pricers[2].first);
+        Real expected = coupon->amount();
+        if (std::fabs(shifted - expected) > 1.0e-6 || std::fabs(shifted - before) < 1.0e-4)
+            BOOST_ERROR("failed to update replication grid after curve change:"
+                        << "\n    before:     " << before
+                        << "\n    after:      " << shifted
+                        << "\n    expected:   " << expected);
+        vars.termStructure.linkTo(flatRate(vars.termStructure->referenceDate(), 0.05,
+                                           Actual365Fixed()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testReplicationGridWithOtherSwapIndex) {
+
+    BOOST_TEST_MESSAGE("Testing CMS replication grids with a swap index "
+                       "different from the volatility cube's...");
+
+    CommonVars vars;
+
+    std::vector<Handle<SwaptionVolatilityStructure> > swaptionVols = {
+                           vars.SabrVolCube1, vars.SabrVolCube2};
+
+    // the cubes were built on the 5% curve; the coupons forward on another one
+    Handle<YieldTermStructure> otherCurve(
+        flatRate(vars.termStructure->referenceDate(), 0.07, Actual365Fixed()));
+    ext::shared_ptr<SwapIndex> swapIndex(new EuriborSwapIsdaFixA(10*Years, otherCurve));
+
+    Date startDate = vars.termStructure->referenceDate() + 1*Years;
+    Schedule schedule(startDate, startDate + 15*Years, 1*Years,
+                      TARGET(), ModifiedFollowing, ModifiedFollowing,
+                      DateGeneration::Forward, false);
+    Leg leg = CmsLeg(schedule, swapIndex).withNotionals(1.0);
+
+    Handle<Quote> meanReversion(ext::make_shared<SimpleQuote>(0.01));
+    for (auto& swaptionVol : swaptionVols) {
+        auto pricer = ext::make_shared<NumericHaganPricer>(
+            swaptionVol, GFunctionFactory::Standard, meanReversion);
+        auto gridPricer = ext::make_shared<NumericHaganPricer>(
+            swaptionVol, GFunctionFactory::Standard, meanReversion,
+            0.0, 1.0, 1.0e-6, QL_MAX_REAL, 8);
+
+        Real tolerance = 2.0e-5;
+        for (auto& cf : leg) {
+            auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(cf);
+            coupon->setPricer(pricer);
+            Real expected = coupon->amount();
+            coupon->setPricer(gridPricer);
+            Real calculated = coupon->amount();
+            if (std::fabs(calculated - expected) > tolerance)
+                BOOST_ERROR("failed to reproduce coupon amount on replication grid:"
+                            << "\n    fixing:     " << coupon->fixingDate()
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << calculated
+                            << "\n    difference: " << calculated - expected
+                            << "\n    tolerance:  " << tolerance);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -346,6 +346,45 @@ BOOST_AUTO_TEST_CASE(testCouponPricing) {
                       tol);
 }
 
+BOOST_AUTO_TEST_CASE(testReplicationGrid) {
+    BOOST_TEST_MESSAGE("Testing cms spread coupons on shared replication grids...");
+
+    TestData d;
+    Real tol = 1E-8; // abs tolerance coupon rate
+
+    ext::shared_ptr<SwapIndex> cms10y =
+        ext::make_shared<EuriborSwapIsdaFixA>(10 * Years, d.yts2, d.yts2);
+    ext::shared_ptr<SwapIndex> cms2y =
+        ext::make_shared<EuriborSwapIsdaFixA>(2 * Years, d.yts2, d.yts2);
+    ext::shared_ptr<SwapSpreadIndex> cms10y2y =
+        ext::make_shared<SwapSpreadIndex>("cms10y2y", cms10y, cms2y);
+
+    // coupons with the same fixing share the marginals of the cms pricer
+    std::vector<ext::shared_ptr<CappedFlooredCmsSpreadCoupon> > coupons;
+    for (Rate cap : {Rate(Null<Rate>()), 0.03})
+        for (Rate floor : {Rate(Null<Rate>()), 0.01})
+            coupons.push_back(ext::make_shared<CappedFlooredCmsSpreadCoupon>(
+                Date(23, February, 2029), 10000.0, Date(23, February, 2028),
+                Date(23, February, 2029), 2, cms10y2y, 1.0, 0.0, cap, floor,
+                Date(), Date(), Actual360(), false));
+
+    for (const auto& vol : {d.swLn, d.swSln, d.swN}) {
+        auto cmsPricer = ext::make_shared<LinearTsrPricer>(vol, d.reversion, d.yts2);
+        auto gridPricer = ext::make_shared<LinearTsrPricer>(
+            vol, d.reversion, d.yts2, LinearTsrPricer::Settings().withReplicationGrid());
+        auto spreadPricer = ext::make_shared<LognormalCmsSpreadPricer>(
+            cmsPricer, d.correlation, d.yts2, 32);
+        auto gridSpreadPricer = ext::make_shared<LognormalCmsSpreadPricer>(
+            gridPricer, d.correlation, d.yts2, 32);
+        for (const auto& coupon : coupons) {
+            coupon->setPricer(spreadPricer);
+            Real expected = coupon->rate();
+            coupon->setPricer(gridSpreadPricer);
+            QL_CHECK_SMALL(std::abs(coupon->rate() - expected), tol);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
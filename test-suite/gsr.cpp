@@ -342,6 +342,67 @@ BOOST_AUTO_TEST_CASE(testGsrProcessWithPathGenerator) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testGsrVectorizedModelFunctions) {
+
+    BOOST_TEST_MESSAGE("Testing vectorized GSR model functions...");
+
+    Date refDate = Settings::instance().evaluationDate();
+
+    std::vector<Date> stepDates;
+    std::vector<Real> vols = {0.01, 0.008};
+    std::vector<Real> reversions = {0.02, 0.01};
+    stepDates.push_back(refDate + 5 * Years);
+
+    Handle<YieldTermStructure> yts(ext::make_shared<FlatForward>(
+        0, TARGET(), 0.03, Actual365Fixed()));
+    Handle<YieldTermStructure> discountCurve(ext::make_shared<FlatForward>(
+        0, TARGET(), 0.02, Actual365Fixed()));
+    auto model = ext::make_shared<Gsr>(yts, stepDates, vols, reversions, 50.0);
+    auto index = ext::make_shared<Euribor6M>(yts);
+
+    Real tol = 1E-12;
+
+    for (Integer m : {0, 6, 30, 90}) {
+        Date reference = refDate + m * Months;
+        Time t = yts->timeFromReference(reference);
+        Array y = model->yGrid(7.0, 16);
+        for (const Handle<YieldTermStructure>& curve :
+             {Handle<YieldTermStructure>(), discountCurve}) {
+            Array numeraires = model->numeraire(t, y, curve);
+            for (Integer n : {1, 12, 60, 240}) {
+                Date maturity = reference + n * Months;
+                Array zerobonds = model->zerobond(maturity, reference, y, curve);
+                for (Size k = 0; k < y.size(); ++k) {
+                    Real expectedNumeraire = model->numeraire(t, y[k], curve);
+                    Real expectedZerobond =
+                        model->zerobond(maturity, reference, y[k], curve);
+                    if (std::fabs(numeraires[k] - expectedNumeraire) > tol)
+                        BOOST_ERROR("vectorized numeraire at t=" << t << ", y=" << y[k]
+                                    << " (" << numeraires[k]
+                                    << ") is different from scalar one ("
+                                    << expectedNumeraire << ")");
+                    if (std::fabs(zerobonds[k] - expectedZerobond) > tol)
+                        BOOST_ERROR("vectorized zerobond P(" << reference << ","
+                                    << maturity << " | y=" << y[k] << ") ("
+                                    << zerobonds[k]
+                                    << ") is different from scalar one ("
+                                    << expectedZerobond << ")");
+                }
+            }
+        }
+        Date fixing = index->fixingCalendar().advance(reference, 1 * Years);
+        Array forwards = model->forwardRate(fixing, reference, y, index);
+        for (Size k = 0; k < y.size(); ++k) {
+            Real expected = model->forwardRate(fixing, reference, y[k], index);
+            if (std::fabs(forwards[k] - expected) > tol)
+                BOOST_ERROR("vectorized forward rate fixing on "
+                            << fixing << " at y=" << y[k] << " (" << forwards[k]
+                            << ") is different from scalar one (" << expected
+                            << ")");
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testGsrModelQuoteUpdate) {
 
     BOOST_TEST_MESSAGE("Testing GSR model when updating quotes...");
@@ -44,6 +44,7 @@
 #include <ql/pricingengines/vanilla/exponentialfittinghestonengine.hpp>
 #include <ql/pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
 #include <ql/pricingengines/vanilla/fdhestonvanillaengine.hpp>
+#include <ql/pricingengines/vanilla/ffthestonengine.hpp>
 #include <ql/pricingengines/vanilla/hestonexpansionengine.hpp>
 #include <ql/pricingengines/vanilla/mceuropeanhestonengine.hpp>
 #include <ql/processes/hestonprocess.hpp>
@@ -369,6 +370,53 @@ BOOST_AUTO_TEST_CASE(testDAXCalibration) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testDAXCalibrationWithParallelHelpers) {
+
+    BOOST_TEST_MESSAGE(
+             "Testing Heston model calibration with parallel helper evaluation...");
+
+    Date settlementDate(5, July, 2002);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    CalibrationMarketData marketData = getDAXCalibrationMarketData();
+
+    const std::vector<ext::shared_ptr<CalibrationHelper> >& options = marketData.options;
+
+    const ext::shared_ptr<HestonModel> model(
+        ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                marketData.riskFreeTS, marketData.dividendYield, marketData.s0,
+                0.1, 1.0, 0.1, 0.5, -0.5)));
+
+    // concurrent evaluation requires one engine per helper; the
+    // market term structures are shared, which is safe since their
+    // lookups don't modify them once they are calculated
+    for (const auto& option : options)
+        ext::dynamic_pointer_cast<BlackCalibrationHelper>(option)->setPricingEngine(
+            ext::make_shared<AnalyticHestonEngine>(model, 64));
+
+    const Array initialParams = model->params();
+
+    LevenbergMarquardt om(1e-8, 1e-8, 1e-8);
+    model->calibrate(options, om,
+                     EndCriteria(400, 40, 1.0e-8, 1.0e-8, 1.0e-8));
+    const Array sequentialParams = model->params();
+
+    model->setParams(initialParams);
+    model->setParallelCalibration(true);
+    model->calibrate(options, om,
+                     EndCriteria(400, 40, 1.0e-8, 1.0e-8, 1.0e-8));
+    const Array parallelParams = model->params();
+
+    for (Size i = 0; i < sequentialParams.size(); ++i) {
+        if (std::fabs(parallelParams[i] - sequentialParams[i]) > 1e-10)
+            BOOST_ERROR("Failed to reproduce sequential calibration"
+                        << "\n    parameter:  " << i
+                        << "\n    sequential: " << sequentialParams[i]
+                        << "\n    parallel:   " << parallelParams[i]);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testAnalyticVsBlack) {
     BOOST_TEST_MESSAGE("Testing analytic Heston engine against Black formula...");
 
@@ -1985,6 +2033,215 @@ BOOST_AUTO_TEST_CASE(testCosHestonEngineTruncation) {
     
 }
 
+BOOST_AUTO_TEST_CASE(testChainPricing) {
+    BOOST_TEST_MESSAGE("Testing Heston pricing of option chains...");
+
+    const Date settlementDate(7, February, 2017);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Handle<YieldTermStructure> riskFreeTS(flatRate(0.05, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(flatRate(0.02, dayCounter));
+
+    const Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+
+    const ext::shared_ptr<HestonModel> model =
+        ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                riskFreeTS, dividendTS, s0, 0.08, 2.0, 0.09, 0.8, -0.6));
+
+    const Date maturityDate = settlementDate + Period(18, Months);
+
+    std::vector<ext::shared_ptr<PlainVanillaPayoff> > payoffs;
+    for (Real strike = 40.0; strike <= 250.0; strike += 7.5) {
+        payoffs.push_back(
+            ext::make_shared<PlainVanillaPayoff>(Option::Call, strike));
+        payoffs.push_back(
+            ext::make_shared<PlainVanillaPayoff>(Option::Put, strike));
+    }
+
+    typedef AnalyticHestonEngine::Integration Integration;
+    const ext::shared_ptr<AnalyticHestonEngine> engines[] = {
+        ext::make_shared<AnalyticHestonEngine>(model, 144),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::AngledContour,
+            Integration::gaussLaguerre(128)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::AndersenPiterbarg,
+            Integration::gaussLegendre(256), 1e-8),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::Gatheral,
+            Integration::gaussLaguerre(128)),
+        ext::make_shared<AnalyticHestonEngine>(model, 1e-10, 10000)
+    };
+
+    const Real tol = 1e-12;
+
+    for (const auto& engine : engines) {
+        const std::vector<Real> chain =
+            engine->priceVanillaPayoffs(payoffs, maturityDate);
+        const Size chainEvaluations = engine->numberOfEvaluations();
+
+        Size evaluations = 0;
+        for (Size i=0; i < payoffs.size(); ++i) {
+            const Real expected =
+                engine->priceVanillaPayoff(payoffs[i], maturityDate);
+            evaluations += engine->numberOfEvaluations();
+
+            if (std::fabs(chain[i] - expected) > tol)
+                BOOST_ERROR("failed to reproduce single option price"
+                            << "\n    strike:     " << payoffs[i]->strike()
+                            << "\n    type:       " << payoffs[i]->optionType()
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << chain[i]);
+        }
+
+        if (chainEvaluations > evaluations)
+            BOOST_ERROR("chain pricing needs more evaluations ("
+                        << chainEvaluations << ") than single pricing ("
+                        << evaluations << ")");
+    }
+
+    // with a fixed quadrature the characteristic function is
+    // evaluated once per node and contour
+    engines[0]->priceVanillaPayoffs(payoffs, maturityDate);
+    if (engines[0]->numberOfEvaluations() > 3*144)
+        BOOST_ERROR("too many characteristic function evaluations: "
+                    << engines[0]->numberOfEvaluations());
+
+    const ext::shared_ptr<COSHestonEngine> cosEngine =
+        ext::make_shared<COSHestonEngine>(model, 16, 200);
+    const ext::shared_ptr<Exercise> exercise =
+        ext::make_shared<EuropeanExercise>(maturityDate);
+
+    const std::vector<Real> cosChain =
+        cosEngine->priceVanillaPayoffs(payoffs, maturityDate);
+
+    for (Size i=0; i < payoffs.size(); ++i) {
+        VanillaOption option(payoffs[i], exercise);
+        option.setPricingEngine(cosEngine);
+        const Real expected = option.NPV();
+
+        if (std::fabs(cosChain[i] - expected) > tol)
+            BOOST_ERROR("failed to reproduce single COS option price"
+                        << "\n    strike:     " << payoffs[i]->strike()
+                        << "\n    type:       " << payoffs[i]->optionType()
+                        << "\n    expected:   " << expected
+                        << "\n    calculated: " << cosChain[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testFFTEngineOnSurface) {
+    BOOST_TEST_MESSAGE("Testing FFT Heston engine on a volatility surface...");
+
+    const Date settlementDate(7, February, 2017);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Handle<YieldTermStructure> riskFreeTS(flatRate(0.05, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(flatRate(0.02, dayCounter));
+
+    const Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+
+    const ext::shared_ptr<HestonModel> model =
+        ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                riskFreeTS, dividendTS, s0, 0.08, 2.0, 0.09, 0.8, -0.6));
+
+    const Period maturities[] = {
+        1*Months, 3*Months, 6*Months, 1*Years, 2*Years, 3*Years, 5*Years, 10*Years
+    };
+
+    std::vector<ext::shared_ptr<Instrument> > options;
+    for (const auto& maturity : maturities) {
+        const ext::shared_ptr<Exercise> exercise =
+            ext::make_shared<EuropeanExercise>(settlementDate + maturity);
+        for (Real strike = 50.0; strike <= 200.0; strike += 5.0)
+            options.push_back(ext::make_shared<VanillaOption>(
+                ext::make_shared<PlainVanillaPayoff>(
+                    strike < 100.0 ? Option::Put : Option::Call, strike),
+                exercise));
+    }
+
+    const auto npvs = [&](const ext::shared_ptr<PricingEngine>& engine) {
+        std::vector<Real> result;
+        for (const auto& option : options) {
+            option->setPricingEngine(engine);
+            result.push_back(option->NPV());
+        }
+        return result;
+    };
+
+    const std::vector<Real> analytic =
+        npvs(ext::make_shared<AnalyticHestonEngine>(model, 192));
+    const std::vector<Real> cos =
+        npvs(ext::make_shared<COSHestonEngine>(model, 16, 200));
+    const std::vector<Real> fft =
+        npvs(ext::make_shared<FFTHestonEngine>(model));
+
+    const auto fftEngine = ext::make_shared<FFTHestonEngine>(model);
+    fftEngine->precalculate(options);
+    const std::vector<Real> precalculated = npvs(fftEngine);
+
+    // the value of an option mustn't depend on the ones priced before
+    std::reverse(options.begin(), options.end());
+    std::vector<Real> reversed = npvs(ext::make_shared<FFTHestonEngine>(model));
+    std::reverse(options.begin(), options.end());
+    std::reverse(reversed.begin(), reversed.end());
+
+    const Real tol = 1e-2;
+    for (Size i=0; i < options.size(); ++i) {
+        const auto option = ext::dynamic_pointer_cast<VanillaOption>(options[i]);
+        const Real errors[] = {
+            std::fabs(cos[i] - analytic[i]),
+            std::fabs(fft[i] - analytic[i]),
+            std::fabs(precalculated[i] - analytic[i])
+        };
+        const std::string names[] = { "COS", "FFT", "precalculated FFT" };
+        for (Size j=0; j < 3; ++j) {
+            if (errors[j] > tol)
+                BOOST_ERROR("failed to reproduce analytic price with "
+                            << names[j] << " engine"
+                            << "\n    strike:     "
+                            << ext::dynamic_pointer_cast<StrikedTypePayoff>(
+                                   option->payoff())->strike()
+                            << "\n    maturity:   " << option->exercise()->lastDate()
+                            << "\n    analytic:   " << analytic[i]
+                            << "\n    error:      " << errors[j]
+                            << "\n    tolerance:  " << tol);
+        }
+
+        if (reversed[i] != fft[i])
+            BOOST_ERROR("FFT price depends on pricing order"
+                        << std::setprecision(16)
+                        << "\n    maturity:   " << option->exercise()->lastDate()
+                        << "\n    in order:   " << fft[i]
+                        << "\n    reversed:   " << reversed[i]);
+    }
+
+    // a precalculated chain with all strikes below the spot
+    std::vector<ext::shared_ptr<Instrument> > puts;
+    for (Size i=0; i < options.size(); ++i) {
+        const auto payoff = ext::dynamic_pointer_cast<StrikedTypePayoff>(
+            ext::dynamic_pointer_cast<VanillaOption>(options[i])->payoff());
+        if (payoff->strike() <= 60.0)
+            puts.push_back(options[i]);
+    }
+    const auto putEngine = ext::make_shared<FFTHestonEngine>(model);
+    putEngine->precalculate(puts);
+    for (const auto& put : puts) {
+        put->setPricingEngine(putEngine);
+        const Real expected = analytic[std::find(options.begin(), options.end(), put)
+                                       - options.begin()];
+        if (std::fabs(put->NPV() - expected) > tol)
+            BOOST_ERROR("failed to reproduce analytic price of a precalculated "
+                        "chain below the spot"
+                        << "\n    analytic:   " << expected
+                        << "\n    calculated: " << put->NPV()
+                        << "\n    tolerance:  " << tol);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testCharacteristicFct) {
     BOOST_TEST_MESSAGE("Testing Heston characteristic function...");
 
@@ -31,6 +31,8 @@
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
+#include <locale>
+#include <sstream>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -117,6 +119,89 @@ BOOST_AUTO_TEST_CASE(testFixingHasHistoricalFixing) {
     testCase(name, fixingNotFound, euribor6M_a->hasHistoricalFixing(today));
 }
 
+BOOST_AUTO_TEST_CASE(testLoadFixings) {
+    BOOST_TEST_MESSAGE("Testing bulk loading of index fixings...");
+
+    IndexManager::instance().clearHistories();
+
+    auto euribor3M = ext::make_shared<Euribor3M>();
+    auto euribor6M = ext::make_shared<Euribor6M>();
+
+    Date start(3, January, 2023);
+    std::ostringstream csv;
+    std::vector<Date> dates;
+    for (Date d = start; d < start + 2*Years; d = TARGET().advance(d, 1, Days)) {
+        dates.push_back(d);
+        csv << euribor3M->name() << "," << io::iso_date(d) << ","
+            << 0.01 + 1.0e-6 * (d - start) << "\n";
+        if (d.weekday() == Friday)
+            csv << "  " << boost::algorithm::to_lower_copy(euribor6M->name())
+                << " , " << io::iso_date(d) << " , 0.02\n\n";
+    }
+    std::istringstream in(csv.str());
+    IndexManager::instance().loadFixings(in);
+
+    for (const auto& d : dates) {
+        Real expected3M = 0.01 + 1.0e-6 * (d - start);
+        if (std::fabs(euribor3M->pastFixing(d) - expected3M) > 1e-15)
+            BOOST_ERROR("wrong fixing loaded for " << euribor3M->name()
+                        << " on " << d << ":"
+                        << "\n    loaded:   " << euribor3M->pastFixing(d)
+                        << "\n    expected: " << expected3M);
+        Real expected6M = d.weekday() == Friday ? 0.02 : Null<Real>();
+        if (euribor6M->pastFixing(d) != expected6M)
+            BOOST_ERROR("wrong fixing loaded for " << euribor6M->name()
+                        << " on " << d << ":"
+                        << "\n    loaded:   " << euribor6M->pastFixing(d)
+                        << "\n    expected: " << expected6M);
+    }
+
+    // fixings added later, before and after the loaded ones
+    Date before = TARGET().advance(start, -1, Days);
+    Date after = TARGET().advance(dates.back(), 1, Days);
+    euribor3M->addFixing(before, 0.005);
+    euribor3M->addFixing(after, 0.015);
+    euribor3M->addFixing(dates[10], 0.03, true);
+    BOOST_CHECK_EQUAL(euribor3M->pastFixing(before), 0.005);
+    BOOST_CHECK_EQUAL(euribor3M->pastFixing(after), 0.015);
+    BOOST_CHECK_EQUAL(euribor3M->pastFixing(dates[10]), 0.03);
+    BOOST_CHECK_EQUAL(euribor3M->timeSeries()[dates[10]], 0.03);
+    BOOST_CHECK_EQUAL(euribor3M->timeSeries().size(), dates.size() + 2);
+
+    std::istringstream wrong("Euribor3M Actual/360,2023-13-01,0.01\n");
+    BOOST_CHECK_EXCEPTION(IndexManager::instance().loadFixings(wrong), Error,
+                          ExpectedErrorMessage("wrong format at line 1"));
+    std::istringstream wrongValue("Euribor3M Actual/360,2023-01-02,0,01\n");
+    BOOST_CHECK_EXCEPTION(IndexManager::instance().loadFixings(wrongValue), Error,
+                          ExpectedErrorMessage("wrong format at line 1"));
+
+    // the values are read with a dot as decimal separator whatever the locale
+    try {
+        std::locale previous = std::locale::global(std::locale("de_DE.UTF-8"));
+        std::istringstream otherLocale("Euribor3M Actual/360,2025-01-03,0.125\n");
+        try {
+            IndexManager::instance().loadFixings(otherLocale);
+        } catch (...) {
+            std::locale::global(previous);
+            throw;
+        }
+        std::locale::global(previous);
+        BOOST_CHECK_EQUAL(euribor3M->pastFixing(Date(3, January, 2025)), 0.125);
+    } catch (std::runtime_error&) {
+        // the locale is not available on this system
+    }
+
+    IndexManager::instance().clearHistories();
+    BOOST_CHECK(!euribor3M->hasHistoricalFixing(dates[10]));
+    BOOST_CHECK(euribor3M->pastFixing(dates[10]) == Null<Real>());
+
+    // lookups don't add histories
+    auto euribor1Y = ext::make_shared<Euribor1Y>();
+    BOOST_CHECK(euribor1Y->pastFixing(dates[10]) == Null<Real>());
+    BOOST_CHECK(euribor1Y->timeSeries().empty());
+    BOOST_CHECK(IndexManager::instance().histories().empty());
+}
+
 BOOST_AUTO_TEST_CASE(testTenorNormalization) {
     BOOST_TEST_MESSAGE("Testing that interest-rate index tenor is normalized correctly...");
 
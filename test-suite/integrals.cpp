@@ -37,6 +37,7 @@
 #include <ql/math/integrals/twodimensionalintegral.hpp>
 #include <ql/experimental/math/piecewisefunction.hpp>
 #include <ql/experimental/math/piecewiseintegral.hpp>
+#include <ql/experimental/math/multidimquadrature.hpp>
 
 #include <boost/math/special_functions/sign.hpp>
 
@@ -265,6 +266,63 @@ BOOST_AUTO_TEST_CASE(testTwoDimensionalIntegration) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testMultidimensionalQuadratureGrids) {
+    BOOST_TEST_MESSAGE("Testing multidimensional Gauss-Hermite grids...");
+
+    // the integral of exp(-|x|^2) cos(a.x) is pi^(d/2) exp(-|a|^2/4)
+    const Size dimension = 4;
+    const std::vector<Real> a = { 0.3, 0.5, 0.7, 0.2 };
+    Real a2 = 0.0;
+    for (Real ai : a)
+        a2 += ai*ai;
+    const Real expected = std::pow(M_PI, 0.5*dimension) * std::exp(-0.25*a2);
+
+    auto f = [&](const std::vector<Real>& x) -> Real {
+        Real ax = 0.0, x2 = 0.0;
+        for (Size k=0; k<dimension; ++k) {
+            ax += a[k]*x[k];
+            x2 += x[k]*x[k];
+        }
+        return std::exp(-x2) * std::cos(ax);
+    };
+    auto blockF = [&](const Matrix& points, Array& values) {
+        std::vector<Real> x(dimension);
+        for (Size i=0; i<points.rows(); ++i) {
+            std::copy(points.row_begin(i), points.row_end(i), x.begin());
+            values[i] = f(x);
+        }
+    };
+
+    const Size order = 9;
+    const Real pointwise =
+        GaussianQuadMultidimIntegrator(dimension, order).integrate<Real>(f);
+
+    GaussianQuadMultidimGrid tensor(dimension, order);
+    BOOST_CHECK_EQUAL(tensor.size(), order*order*order*order);
+    for (Size blockSize : { 1, 7, 256 }) {
+        const Real calculated = tensor.integrate(blockF, blockSize);
+        if (std::fabs(calculated - pointwise) > 1.0e-12)
+            BOOST_ERROR("tensor grid integration differs from pointwise one"
+                        << "\n    block size: " << blockSize
+                        << std::setprecision(12)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << pointwise);
+    }
+
+    // same finest rule as the tensor product
+    GaussianQuadMultidimGrid sparse(dimension, 5,
+                                    GaussianQuadMultidimGrid::SparseGrid);
+    BOOST_CHECK(sparse.size() < tensor.size());
+    const Real tolerance = 1.0e-7;
+    for (Real calculated : { pointwise, sparse.integrate(blockF) }) {
+        if (std::fabs(calculated - expected) > tolerance)
+            BOOST_ERROR("failed to reproduce expected value"
+                        << std::setprecision(12)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testFolinIntegration) {
     BOOST_TEST_MESSAGE("Testing Folin's integral formulae...");
 
@@ -31,6 +31,7 @@
 #include <ql/math/integrals/simpsonintegral.hpp>
 #include <ql/math/interpolations/backwardflatinterpolation.hpp>
 #include <ql/math/interpolations/bicubicsplineinterpolation.hpp>
+#include <ql/math/interpolations/bilinearinterpolation.hpp>
 #include <ql/math/interpolations/chebyshevinterpolation.hpp>
 #include <ql/math/interpolations/cubicinterpolation.hpp>
 #include <ql/math/interpolations/flatextrapolation.hpp>
@@ -39,6 +40,7 @@
 #include <ql/math/interpolations/kernelinterpolation2d.hpp>
 #include <ql/math/interpolations/lagrangeinterpolation.hpp>
 #include <ql/math/interpolations/linearinterpolation.hpp>
+#include <ql/math/interpolations/loginterpolation.hpp>
 #include <ql/math/interpolations/mixedinterpolation.hpp>
 #include <ql/math/interpolations/multicubicspline.hpp>
 #include <ql/math/interpolations/sabrinterpolation.hpp>
@@ -46,6 +48,7 @@
 #include <ql/math/optimization/levenbergmarquardt.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/math/richardsonextrapolation.hpp>
+#include <ql/termstructures/volatility/sabrsmilesection.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/utilities/null.hpp>
 #include <cmath>
@@ -1542,6 +1545,56 @@ BOOST_AUTO_TEST_CASE(testSabrGuess){
 }
 
 
+BOOST_AUTO_TEST_CASE(testSabrVolatilities) {
+
+    BOOST_TEST_MESSAGE("Testing Sabr volatilities on multiple strikes...");
+
+    Time expiry = 5.0;
+    Real forward = 0.03, alpha = 0.04, beta = 0.5, nu = 0.4, rho = -0.3, shift = 0.01;
+    std::vector<Rate> strikes;
+    for (Rate k = -0.0095; k < 0.2; k += 0.0005)
+        strikes.push_back(k);
+
+    for (auto type: {VolatilityType::ShiftedLognormal, VolatilityType::Normal}) {
+        Real typeAlpha = type == VolatilityType::Normal ? alpha * 0.15 : alpha;
+        std::vector<Real> calculated =
+            shiftedSabrVolatilities(strikes, forward, expiry,
+                                    typeAlpha, beta, nu, rho, shift, type);
+        for (Size i=0; i<strikes.size(); ++i) {
+            Real expected = shiftedSabrVolatility(strikes[i], forward, expiry,
+                                                  typeAlpha, beta, nu, rho, shift, type);
+            if (calculated[i] != expected)
+                BOOST_ERROR("failed to reproduce Sabr volatility at strike "
+                            << strikes[i]
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << calculated[i]);
+        }
+
+        // the section interpolates on a grid of precomputed volatilities
+        SabrSmileSection section(expiry, forward,
+                                 {typeAlpha, beta, nu, rho}, shift, type);
+        std::vector<Volatility> exact(strikes.size());
+        for (Size i=0; i<strikes.size(); ++i)
+            exact[i] = section.volatility(strikes[i]);
+        section.precomputeVolatilities(200);
+        Real tolerance = 1.0e-6 * exact[strikes.size()/2];
+        for (Size i=0; i<strikes.size(); ++i) {
+            Volatility interpolated = section.volatility(strikes[i]);
+            if (std::fabs(interpolated - exact[i]) > tolerance)
+                BOOST_ERROR("failed to interpolate Sabr volatility at strike "
+                            << strikes[i]
+                            << "\n    exact:        " << exact[i]
+                            << "\n    interpolated: " << interpolated
+                            << "\n    error:        " << interpolated - exact[i]
+                            << "\n    tolerance:    " << tolerance);
+        }
+    }
+
+    BOOST_CHECK_THROW(sabrVolatilities({0.01, -0.01}, forward, expiry,
+                                       alpha, beta, nu, rho),
+                      Error);
+}
+
 BOOST_AUTO_TEST_CASE(testKernelInterpolation) {
 
     BOOST_TEST_MESSAGE("Testing kernel 1D interpolation...");
@@ -3133,6 +3186,153 @@ BOOST_AUTO_TEST_CASE(testFlatExtrapolation) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testLocate) {
+
+    BOOST_TEST_MESSAGE("Testing interval lookup...");
+
+    std::vector<std::vector<Real>> grids = {
+        // uniform
+        xRange(0.0, 10.0, 41),
+        // near-uniform
+        { 0.0, 0.26, 0.49, 0.77, 1.0, 1.24, 1.52, 1.75, 2.01 },
+        // strongly non-uniform
+        { 0.0, 0.001, 0.01, 0.1, 0.5, 1.0, 2.0, 5.0, 10.0, 30.0 },
+        // minimal
+        { 1.0, 2.0 }
+    };
+
+    for (const auto& grid : grids) {
+        Size n = grid.size();
+        Real xMin = grid.front(), xMax = grid.back();
+
+        // nodes, points in between and outside the grid...
+        std::vector<Real> points(grid);
+        Size m = 997;
+        for (Size i=0; i<m; ++i)
+            points.push_back(xMin - 1.0 + i*(xMax-xMin+2.0)/(m-1));
+        std::sort(points.begin(), points.end());
+        // ...visited in increasing, decreasing and scattered order
+        std::vector<Real> sequence(points);
+        sequence.insert(sequence.end(), points.rbegin(), points.rend());
+        for (Size i=0; i<points.size(); ++i)
+            sequence.push_back(points[(i*389) % points.size()]);
+
+        for (Real x : sequence) {
+            Size expected;
+            if (x < xMin)
+                expected = 0;
+            else if (x > xMax)
+                expected = n-2;
+            else
+                expected = std::upper_bound(grid.begin(), grid.end()-1, x)
+                    - grid.begin() - 1;
+            Size calculated = QuantLib::detail::locate(grid.begin(), grid.end(), x);
+            if (calculated != expected)
+                BOOST_ERROR("wrong interval located for x = " << x
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << calculated);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testBatchedEvaluation) {
+
+    BOOST_TEST_MESSAGE("Testing batched evaluation of interpolations...");
+
+    std::vector<Real> x = { 0.1, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0 };
+    std::vector<Real> y = { 1.0, 1.2, 1.1, 1.5, 1.4, 2.0, 2.2, 2.1, 2.5 };
+
+    std::vector<Real> points = xRange(0.0, 11.0, 501);
+    std::vector<Real> reversed(points.rbegin(), points.rend());
+
+    std::vector<std::pair<std::string, Interpolation>> interpolations = {
+        { "linear", LinearInterpolation(x.begin(), x.end(), y.begin()) },
+        { "cubic", CubicNaturalSpline(x.begin(), x.end(), y.begin()) },
+        { "log-linear", LogLinearInterpolation(x.begin(), x.end(), y.begin()) }
+    };
+
+    for (auto& i : interpolations) {
+        const std::string& name = i.first;
+        Interpolation& f = i.second;
+
+        std::vector<Real> batched(points.size());
+        auto end = f(points.begin(), points.end(), batched.begin(), true);
+        if (end != batched.end())
+            BOOST_FAIL(name << ": wrong output iterator returned");
+
+        // pointwise evaluation in the opposite order must agree exactly
+        for (Size j=0; j<reversed.size(); ++j) {
+            Real expected = f(reversed[j], true);
+            Real calculated = batched[points.size()-1-j];
+            if (calculated != expected)
+                BOOST_ERROR(name << " interpolation: batched evaluation mismatch"
+                            << "\n    x:          " << reversed[j]
+                            << std::setprecision(16)
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << calculated);
+        }
+
+        // without extrapolation, points out of range must throw
+        BOOST_CHECK_THROW(f(points.begin(), points.end(), batched.begin()), Error);
+    }
+
+    Matrix z(y.size(), x.size());
+    for (Size r=0; r<z.rows(); ++r)
+        for (Size c=0; c<z.columns(); ++c)
+            z[r][c] = y[r] * std::sqrt(x[c]);
+    BilinearInterpolation f(x.begin(), x.end(), y.begin(), y.end(), z);
+
+    // row by row, then in the opposite order
+    std::vector<Real> values;
+    for (Real u : points)
+        for (Real v : points)
+            values.push_back(f(u, 0.25*v, true));
+    Size k = values.size();
+    for (Real u : reversed) {
+        for (Real v : reversed) {
+            Real expected = values[--k];
+            Real calculated = f(u, 0.25*v, true);
+            if (calculated != expected)
+                BOOST_ERROR("bilinear interpolation: evaluation depends on order"
+                            << "\n    (x,y):      (" << u << ", " << 0.25*v << ")"
+                            << std::setprecision(16)
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << calculated);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testBatchedEvaluationOnLargeGrid) {
+
+    BOOST_TEST_MESSAGE("Testing batched evaluation on a large grid...");
+
+    // non-uniform grid, as in term structures or FD meshes
+    Size n = 10000;
+    std::vector<Real> x(n), y(n);
+    for (Size i=0; i<n; ++i) {
+        Real u = Real(i)/(n-1);
+        x[i] = 30.0*u*u + 0.01*u;
+        y[i] = std::exp(-0.03*x[i]);
+    }
+    LinearInterpolation f(x.begin(), x.end(), y.begin());
+
+    std::vector<Real> points = xRange(0.0, 30.01, 200000);
+    std::vector<Real> values(points.size());
+    f(points.begin(), points.end(), values.begin());
+
+    Real tolerance = 1.0e-6;
+    for (Size j=0; j<points.size(); j+=997) {
+        Real expected = std::exp(-0.03*points[j]);
+        if (std::fabs(values[j]-expected) > tolerance)
+            BOOST_ERROR("batched evaluation failed at x = " << points[j]
+                        << std::scientific
+                        << "\n    interpolated value: " << values[j]
+                        << "\n    expected value:     " << expected
+                        << "\n    error:              "
+                        << std::fabs(values[j]-expected));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include "toplevelfixture.hpp"
 #include "utilities.hpp"
 #include <ql/models/marketmodels/accountingengine.hpp>
+#include <ql/models/marketmodels/parallelaccountingengine.hpp>
 #include <ql/models/marketmodels/browniangenerators/mtbrowniangenerator.hpp>
 #include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
 #include <ql/models/marketmodels/callability/collectnodedata.hpp>
@@ -37,6 +38,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <ql/models/marketmodels/callability/upperboundengine.hpp>
 #include <ql/models/marketmodels/curvestates/lmmcurvestate.hpp>
 #include <ql/models/marketmodels/driftcomputation/lmmdriftcalculator.hpp>
+#include <ql/models/marketmodels/driftcomputation/lmmnormaldriftcalculator.hpp>
 #include <ql/models/marketmodels/evolvers/lognormalfwdrateeuler.hpp>
 #include <ql/models/marketmodels/evolvers/lognormalfwdrateeulerconstrained.hpp>
 #include <ql/models/marketmodels/evolvers/lognormalfwdrateipc.hpp>
@@ -1225,6 +1227,75 @@ BOOST_AUTO_TEST_CASE(testAllMultiStepProducts) {
         testDescription);
 }
 
+BOOST_AUTO_TEST_CASE(testParallelAccountingEngine) {
+
+    BOOST_TEST_MESSAGE("Testing parallel accounting engine "
+                       "against sequential simulation...");
+
+    setup();
+
+    MultiProductComposite product;
+    std::vector<SubProductExpectedValues> subProductExpectedValues;
+    addForwards(product, subProductExpectedValues);
+    addOptionLets(product, subProductExpectedValues);
+    product.finalize();
+
+    EvolutionDescription evolution = product.evolution();
+    std::vector<Size> numeraires = moneyMarketPlusMeasure(evolution, measureOffset_);
+    ext::shared_ptr<MarketModel> marketModel =
+        makeMarketModel(true, evolution, 3, ExponentialCorrelationAbcdVolatility);
+    Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+
+    auto makeEngine = [&](Size firstPath) {
+        SobolBrownianGeneratorFactory generatorFactory(
+            SobolBrownianGenerator::Diagonal, seed_, SobolRsg::Jaeckel, firstPath);
+        return ext::make_shared<AccountingEngine>(
+            makeMarketModelEvolver(marketModel, numeraires, generatorFactory, Pc),
+            product, initialNumeraireValue);
+    };
+
+    // the streams draw contiguous blocks of the same Sobol sequence,
+    // so that they simulate the same paths as a single engine
+    const Size paths = 4095;
+    SequenceStatisticsInc expected(product.numberOfProducts());
+    makeEngine(0)->multiplePathValues(expected, paths);
+
+    const Size streams[] = { 1, 3, 4 };
+    for (Size numberOfStreams : streams) {
+        ParallelAccountingEngine<AccountingEngine> engine(makeEngine,
+                                                          numberOfStreams, 500);
+        SequenceStatisticsInc calculated(product.numberOfProducts());
+        engine.multiplePathValues(calculated, paths);
+        SequenceStatisticsInc repeated(product.numberOfProducts());
+        engine.multiplePathValues(repeated, paths);
+
+        if (calculated.samples() != paths)
+            BOOST_ERROR("wrong number of samples with " << numberOfStreams
+                        << " streams: " << calculated.samples()
+                        << " instead of " << paths);
+
+        std::vector<Real> expectedMean = expected.mean();
+        std::vector<Real> calculatedMean = calculated.mean();
+        std::vector<Real> repeatedMean = repeated.mean();
+        for (Size i=0; i<expectedMean.size(); ++i) {
+            if (std::fabs(calculatedMean[i] - expectedMean[i]) > 1.0e-12)
+                BOOST_ERROR("failed to reproduce sequential simulation with "
+                            << numberOfStreams << " streams"
+                            << "\n    product:    " << i
+                            << std::scientific << std::setprecision(12)
+                            << "\n    calculated: " << calculatedMean[i]
+                            << "\n    expected:   " << expectedMean[i]);
+            if (repeatedMean[i] != calculatedMean[i])
+                BOOST_ERROR("non-deterministic results with "
+                            << numberOfStreams << " streams"
+                            << "\n    product:    " << i
+                            << std::scientific << std::setprecision(12)
+                            << "\n    first run:  " << calculatedMean[i]
+                            << "\n    second run: " << repeatedMean[i]);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testPeriodAdapter) {
 
     BOOST_TEST_MESSAGE("Testing period-adaptation routines in LIBOR market model...");
@@ -2873,6 +2944,12 @@ BOOST_AUTO_TEST_CASE(testPathwiseVegas) {
 
                 Size numberFailures=0;
                 Size numberFailures2=0;
+                Size numberFailures3=0;
+
+                Array weights(numberRates);
+                for (Size i=0; i < numberRates; ++i)
+                    weights[i] = 1.0 + 0.1*i;
+                Matrix weightedB(numberRates, factors);
 
                 for (Size l=0; l < pathsToDo; ++l)
                 {
@@ -2909,6 +2986,29 @@ BOOST_AUTO_TEST_CASE(testPathwiseVegas) {
                         testers[currentStep].getBumps(oldRates, oneStepDFs, newRates, gaussians, B2);
                         testersDown[currentStep].getBumps(oldRates, oneStepDFs, newRates, gaussians, B3);
 
+                        // the adjoint computation must agree with the
+                        // weighted sum of the full jacobian
+                        testees2[currentStep].getWeightedBumps(oldRates, oneStepDFs, newRates,
+                                                               gaussians, weights.begin(),
+                                                               weightedB);
+                        for (Size k1=0; k1 < numberRates; ++k1)
+                            for (Size f1=0; f1 < factors; ++f1)
+                            {
+                                Real expected = 0.0;
+                                for (Size j1=0; j1 < numberRates; ++j1)
+                                    expected += weights[j1]*globalB[j1][k1][f1];
+
+                                if (std::fabs(weightedB[k1][f1] - expected) > 1.0e-13)
+                                {
+                                    ++numberFailures3;
+                                    if (printReport_)
+                                        BOOST_TEST_MESSAGE("path " << l << " step "
+                                        << currentStep << " k " << k1 << " f " << f1
+                                        << " adjoint " << weightedB[k1][f1]
+                                        << " jacobian " << expected);
+                                }
+                            }
+
                         // now do make out put of allElements class into same form 
 
                         for (Size i1 =0; i1 < pseudoBumps.size(); ++i1)
@@ -2978,6 +3078,9 @@ BOOST_AUTO_TEST_CASE(testPathwiseVegas) {
                 
                 if (numberFailures2 >0)
                     BOOST_FAIL("Pathwise rate pseudoroot jacobian all elements test fails : " << numberFailures2 <<"\n");
+
+                if (numberFailures3 >0)
+                    BOOST_FAIL("Pathwise rate pseudoroot adjoint test fails : " << numberFailures3 <<"\n");
             } // end of k loop over measures
 
 
@@ -4530,6 +4633,65 @@ BOOST_AUTO_TEST_CASE(testDriftCalculator) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testReducedFactorDriftCalculators) {
+
+    // Test reduced factor drifts against the ones computed from the
+    // covariance matrix for larger rate/factor configurations
+
+    BOOST_TEST_MESSAGE("Testing reduced-factor drift calculation "
+                       "with many rates...");
+
+    const Size configurations[][2] = { { 40, 5 }, { 120, 10 } };
+    for (const auto& configuration : configurations) {
+        const Size numberOfRates = configuration[0];
+        const Size numberOfFactors = configuration[1];
+
+        std::vector<Time> taus(numberOfRates, 0.25);
+        std::vector<Rate> forwards(numberOfRates);
+        std::vector<Spread> displacements(numberOfRates, 0.01);
+        Matrix pseudo(numberOfRates, numberOfFactors);
+        for (Size i=0; i<numberOfRates; ++i) {
+            forwards[i] = 0.03 + 0.0005*i;
+            for (Size r=0; r<numberOfFactors; ++r)
+                pseudo[i][r] = 0.1 * std::sqrt(taus[i]/numberOfFactors)
+                    * std::cos(M_PI*r*(i+0.5)/numberOfRates);
+        }
+
+        std::vector<Real> drifts(numberOfRates), driftsReduced(numberOfRates);
+        const Real tolerance = 1.0e-15;
+        for (Size alive=0; alive<numberOfRates; alive+=7) {
+            for (Size numeraire=alive; numeraire<=numberOfRates; ++numeraire) {
+                LMMDriftCalculator lognormal(pseudo, displacements, taus,
+                                             numeraire, alive);
+                LMMNormalDriftCalculator normal(pseudo, taus, numeraire, alive);
+                for (Size k=0; k<2; ++k) {
+                    if (k == 0) {
+                        lognormal.computePlain(forwards, drifts);
+                        lognormal.computeReduced(forwards, driftsReduced);
+                    } else {
+                        normal.computePlain(forwards, drifts);
+                        normal.computeReduced(forwards, driftsReduced);
+                    }
+                    for (Size i=alive; i<numberOfRates; ++i) {
+                        Real error = std::fabs(driftsReduced[i]-drifts[i]);
+                        if (error > tolerance)
+                            BOOST_ERROR((k == 0 ? "lognormal" : "normal")
+                                        << " drifts, " << numberOfRates << " rates, "
+                                        << numberOfFactors << " factors, "
+                                        << io::ordinal(alive + 1) << " alive rate, "
+                                        << "numeraire " << numeraire << ", "
+                                        << io::ordinal(i + 1) << " drift: "
+                                        << "\ndrift        =" << drifts[i]
+                                        << "\ndriftReduced =" << driftsReduced[i]
+                                        << "\n       error =" << error
+                                        << "\n   tolerance =" << tolerance);
+                    }
+                }
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testIsInSubset) {
 
     // Performance test for isInSubset function (temporary)
@@ -21,6 +21,7 @@
 #include "utilities.hpp"
 #include <ql/currencies/europe.hpp>
 #include <ql/experimental/credit/constantlosslatentmodel.hpp>
+#include <ql/experimental/credit/defaultprobabilitylatentmodel.hpp>
 #include <ql/experimental/credit/integralntdengine.hpp>
 #include <ql/experimental/credit/nthtodefault.hpp>
 #include <ql/experimental/credit/pool.hpp>
@@ -32,6 +33,7 @@
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/time/calendars/target.hpp>
 #include <ql/time/daycounters/actual360.hpp>
+#include <ql/time/daycounters/actual365fixed.hpp>
 #include <iostream>
 #include <string>
 
@@ -44,6 +46,30 @@ BOOST_AUTO_TEST_SUITE(NthToDefaultTests)
 
 #ifndef QL_PATCH_SOLARIS
 
+namespace {
+
+    ext::shared_ptr<Basket> makeBasket(const Date& asofDate,
+                                       const std::vector<Real>& hazardRates) {
+        ext::shared_ptr<Pool> pool = ext::make_shared<Pool>();
+        std::vector<std::string> namesIds;
+        for (Size i=0; i<hazardRates.size(); i++) {
+            namesIds.push_back(std::string("Name") + std::to_string(i));
+            Handle<DefaultProbabilityTermStructure> curve(
+                ext::make_shared<FlatHazardRate>(asofDate, hazardRates[i],
+                                                 Actual365Fixed()));
+            std::vector<QuantLib::Issuer::key_curve_pair> curves(1,
+                std::make_pair(NorthAmericaCorpDefaultKey(
+                    EURCurrency(), QuantLib::SeniorSec, Period(), 1.), curve));
+            pool->add(namesIds.back(), Issuer(curves), NorthAmericaCorpDefaultKey(
+                    EURCurrency(), QuantLib::SeniorSec, Period(), 1.));
+        }
+        return ext::make_shared<Basket>(asofDate, namesIds,
+            std::vector<Real>(hazardRates.size(), 100.0), pool, 0., 1.);
+    }
+
+}
+
+
 struct hwDatum {
     Size rank;
     Real spread[3];
@@ -374,6 +400,158 @@ BOOST_AUTO_TEST_CASE(testStudent) {
     //END
 }
 
+BOOST_AUTO_TEST_CASE(testLatentModelIntegrations) {
+    BOOST_TEST_MESSAGE("Testing latent model integrations with several factors...");
+
+    Date asofDate(31, August, 2006);
+    Settings::instance().evaluationDate() = asofDate;
+
+    Size names = 6;
+    std::vector<std::vector<Real> > factorWeights;
+    for (Size i=0; i<names; i++)
+        factorWeights.push_back({ 0.3 + 0.05*i, 0.2, -0.1 + 0.04*i });
+    ext::shared_ptr<Basket> basket =
+        makeBasket(asofDate, std::vector<Real>(names, 0.01));
+
+    GaussianDefProbLM tensor(factorWeights,
+                             LatentModelIntegrationType::GaussianQuadrature);
+    GaussianDefProbLM sparse(factorWeights,
+                             LatentModelIntegrationType::SparseGridQuadrature);
+    tensor.resetBasket(basket);
+    sparse.resetBasket(basket);
+
+    // the sparse grid has far fewer points than the tensor one
+    const Real tolerances[] = { 1.0e-6, 1.0e-5 };
+    const Real blockTolerance = 1.0e-12;
+    for (Size i=0; i<names; i++) {
+        for (Probability p : { 0.01, 0.1, 0.5 }) {
+            // the conditional probabilities integrate to the unconditional one;
+            //   the joint default probability with the next name is
+            //   compared between the two grids.
+            Size j = (i+1) % names;
+            Real expected[] = { p, 0.0 };
+            Real calculated[2][2], calculatedBlocks[2][2];
+            const GaussianDefProbLM* models[] = { &tensor, &sparse };
+            for (Size m=0; m<2; m++) {
+                const GaussianDefProbLM& lm = *models[m];
+                auto single = [&](const std::vector<Real>& x) -> Real {
+                    return lm.conditionalDefaultProbability(p, i, x);
+                };
+                auto joint = [&](const std::vector<Real>& x) -> Real {
+                    return lm.conditionalDefaultProbability(p, i, x)
+                        * lm.conditionalDefaultProbability(p, j, x);
+                };
+                auto blocks = [](const std::function<Real(const std::vector<Real>&)>& f) {
+                    return [f](const Matrix& points, Array& values) {
+                        std::vector<Real> x(points.columns());
+                        for (Size k=0; k<points.rows(); ++k) {
+                            std::copy(points.row_begin(k), points.row_end(k),
+                                      x.begin());
+                            values[k] = f(x);
+                        }
+                    };
+                };
+                calculated[m][0] = lm.integratedExpectedValue(single);
+                calculated[m][1] = lm.integratedExpectedValue(joint);
+                calculatedBlocks[m][0] =
+                    lm.integratedExpectedValueBlocks(blocks(single));
+                calculatedBlocks[m][1] =
+                    lm.integratedExpectedValueBlocks(blocks(joint));
+            }
+            expected[1] = calculated[0][1];
+
+            for (Size m=0; m<2; m++) {
+                for (Size k=0; k<2; k++) {
+                    if (std::fabs(calculated[m][k] - expected[k]) > tolerances[m])
+                        BOOST_ERROR("failed to reproduce "
+                                    << (k == 0 ? "default" : "joint default")
+                                    << " probability with "
+                                    << (m == 0 ? "tensor" : "sparse") << " grid"
+                                    << "\n    name:       " << i
+                                    << "\n    probability: " << p
+                                    << std::setprecision(12)
+                                    << "\n    calculated: " << calculated[m][k]
+                                    << "\n    expected:   " << expected[k]);
+                    if (std::fabs(calculatedBlocks[m][k] - calculated[m][k])
+                        > blockTolerance)
+                        BOOST_ERROR("block integration differs from pointwise one with "
+                                    << (m == 0 ? "tensor" : "sparse") << " grid"
+                                    << "\n    name:       " << i
+                                    << "\n    probability: " << p
+                                    << std::setprecision(16)
+                                    << "\n    calculated: " << calculatedBlocks[m][k]
+                                    << "\n    expected:   " << calculated[m][k]);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testRandomDefaultHorizon) {
+    BOOST_TEST_MESSAGE("Testing simulated defaults before the horizon...");
+
+    Date asofDate(31, August, 2006);
+    Settings::instance().evaluationDate() = asofDate;
+
+    // from negligible to almost certain defaults before the horizon
+    std::vector<Real> hazardRates = { 0.001, 0.01, 0.02, 0.05, 0.1, 0.3, 1.0, 5.0 };
+    Size names = hazardRates.size();
+    std::vector<std::vector<Real> > factorWeights;
+    for (Size i=0; i<names; i++)
+        factorWeights.push_back({ 0.5 - 0.05*i, 0.1 + 0.05*i });
+    ext::shared_ptr<Basket> basket = makeBasket(asofDate, hazardRates);
+
+    auto lm = ext::make_shared<GaussianDefProbLM>(factorWeights,
+        LatentModelIntegrationType::GaussianQuadrature);
+    Size nSims = 5000;
+    BigNatural seed = 2863311530UL;
+    basket->setLossModel(ext::make_shared<RandomDefaultLM<GaussianCopulaPolicy> >(
+        lm, std::vector<Real>(names, 0.4), nSims, 1.e-6, seed));
+
+    // the simulation tests the defaults against the probabilities at its
+    //   maximum horizon; the same samples are tested here name by name.
+    Date horizon = asofDate + 4050*Days;
+    std::vector<Probability> horizonPs;
+    const ext::shared_ptr<Pool>& pool = basket->pool();
+    for (Size i=0; i<names; i++)
+        horizonPs.push_back(pool->get(pool->names()[i]).defaultProbability(
+            basket->defaultKeys()[i])->defaultProbability(horizon, true));
+
+    LatentModel<GaussianCopulaPolicy>::FactorSampler<SobolRsg> sampler(lm->copula(), seed);
+    std::vector<Size> counts(names+1, 0);
+    std::vector<Real> values;
+    for (Size k=0; k<nSims; k++) {
+        const std::vector<Real>& sample = sampler.nextSequence().value;
+        lm->latentVarValues(sample, values);
+        Size defaults = 0;
+        for (Size i=0; i<names; i++) {
+            Real value = lm->latentVarValue(sample, i);
+            if (std::fabs(values[i] - value) > 1.0e-14)
+                BOOST_FAIL("latent variable values differ from single ones"
+                           << "\n    name:       " << i
+                           << std::setprecision(16)
+                           << "\n    calculated: " << values[i]
+                           << "\n    expected:   " << value);
+            if (lm->cumulativeY(values[i], i) <= horizonPs[i])
+                ++defaults;
+        }
+        for (Size n=1; n<=defaults; n++)
+            ++counts[n];
+    }
+
+    // every simulated default happens before this date
+    Date d = asofDate + 20*Years;
+    for (Size n=1; n<=names; n++) {
+        Probability calculated = basket->probAtLeastNEvents(n, d);
+        Probability expected = Real(counts[n]) / nSims;
+        if (calculated != expected)
+            BOOST_ERROR("failed to reproduce probability of defaults"
+                        << "\n    defaults:   " << n
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expected);
+    }
+}
+
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -919,6 +919,76 @@ BOOST_AUTO_TEST_CASE(testSwitchStrike) {
                    << "\ntolerance:     " << io::rate(vars.tolerance));
 }
 
+BOOST_AUTO_TEST_CASE(testIncrementalStripping) {
+    BOOST_TEST_MESSAGE("Testing optionlet restripping after term vol and curve changes...");
+
+    CommonVars vars;
+    Settings::instance().evaluationDate() = Date(28, October, 2013);
+    vars.setCapFloorTermVolSurface();
+
+    std::vector<std::vector<ext::shared_ptr<SimpleQuote> > > quotes(vars.optionTenors.size());
+    std::vector<std::vector<Handle<Quote> > > handles(vars.optionTenors.size());
+    for (Size i=0; i<vars.optionTenors.size(); ++i) {
+        for (Size j=0; j<vars.strikes.size(); ++j) {
+            quotes[i].push_back(ext::make_shared<SimpleQuote>(vars.termV[i][j]));
+            handles[i].emplace_back(quotes[i].back());
+        }
+    }
+    auto surface = ext::make_shared<CapFloorTermVolSurface>(0, vars.calendar, Following,
+                                                            vars.optionTenors, vars.strikes,
+                                                            handles, vars.dayCounter);
+
+    RelinkableHandle<YieldTermStructure> curve(vars.yieldTermStructure.currentLink());
+    auto iborIndex = ext::make_shared<Euribor6M>(curve);
+    OptionletStripper1 stripper(surface, iborIndex, Null<Rate>(), vars.accuracy);
+    stripper.capFloorPrices();
+
+    auto check = [&](const std::string& scenario) {
+        Matrix termV(vars.optionTenors.size(), vars.strikes.size());
+        for (Size i=0; i<vars.optionTenors.size(); ++i)
+            for (Size j=0; j<vars.strikes.size(); ++j)
+                termV[i][j] = quotes[i][j]->value();
+        auto freshSurface = ext::make_shared<CapFloorTermVolSurface>(
+            0, vars.calendar, Following, vars.optionTenors, vars.strikes, termV,
+            vars.dayCounter);
+        OptionletStripper1 fresh(freshSurface, iborIndex, Null<Rate>(), vars.accuracy);
+
+        const Matrix& prices = stripper.capFloorPrices();
+        const Matrix& expectedPrices = fresh.capFloorPrices();
+        for (Size i=0; i<prices.rows(); ++i) {
+            for (Size j=0; j<prices.columns(); ++j) {
+                if (std::fabs(prices[i][j] - expectedPrices[i][j]) > 1.0e-12)
+                    BOOST_FAIL("cap/floor price not updated after " << scenario << ":"
+                               << "\n    tenor:      " << stripper.optionletFixingTenors()[i]
+                               << "\n    strike:     " << io::rate(vars.strikes[j])
+                               << "\n    calculated: " << prices[i][j]
+                               << "\n    expected:   " << expectedPrices[i][j]);
+            }
+        }
+        for (Size i=0; i<stripper.optionletMaturities(); ++i) {
+            const std::vector<Volatility>& vols = stripper.optionletVolatilities(i);
+            const std::vector<Volatility>& expected = fresh.optionletVolatilities(i);
+            for (Size j=0; j<vols.size(); ++j) {
+                if (std::fabs(vols[j] - expected[j]) > 1.0e-5)
+                    BOOST_FAIL("optionlet volatility not updated after " << scenario << ":"
+                               << "\n    tenor:      " << stripper.optionletFixingTenors()[i]
+                               << "\n    strike:     " << io::rate(vars.strikes[j])
+                               << "\n    calculated: " << io::volatility(vols[j])
+                               << "\n    expected:   " << io::volatility(expected[j]));
+            }
+        }
+    };
+
+    quotes[5][7]->setValue(vars.termV[5][7] + 0.01);
+    check("term vol change");
+
+    curve.linkTo(ext::make_shared<FlatForward>(0, vars.calendar, 0.045, vars.dayCounter));
+    check("curve change");
+
+    quotes[5][7]->setValue(vars.termV[5][7]);
+    check("term vol reset");
+}
+
 BOOST_AUTO_TEST_CASE(testTermVolatilityStripping1ON) {
     BOOST_TEST_MESSAGE("Testing optionlet stripping with overnight index...");
     CommonVarsON vars;
@@ -1996,6 +1996,191 @@ BOOST_AUTO_TEST_CASE(testOvernightLegWeekendStub) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(testPastFixingsAfterUpdates) {
+    BOOST_TEST_MESSAGE("Testing past overnight fixings after the history is updated...");
+
+    CommonVars vars;
+
+    auto compounded = vars.makeCoupon(Date(18, October, 2021),
+                                      Date(18, November, 2021));
+    auto averaged = vars.makeCoupon(Date(18, October, 2021),
+                                    Date(18, November, 2021),
+                                    Null<Natural>(), 0, false, false,
+                                    RateAveraging::Simple);
+
+    auto expectedRates = [&]() {
+        const auto& fixingDates = compounded->fixingDates();
+        const auto& dt = compounded->dt();
+        Real compoundFactor = 1.0, accumulatedRate = 0.0;
+        for (Size i=0; i<fixingDates.size(); ++i) {
+            Rate fixing = vars.sofr->fixing(fixingDates[i]);
+            compoundFactor *= 1.0 + fixing * dt[i];
+            accumulatedRate += fixing * dt[i];
+        }
+        Time tau = compounded->accrualPeriod();
+        return std::make_pair((compoundFactor - 1.0) / tau, accumulatedRate / tau);
+    };
+
+    auto checkRates = [&]() {
+        auto [compoundedRate, averagedRate] = expectedRates();
+        CHECK_OIS_COUPON_RESULT("compounded coupon rate", compounded->rate(), compoundedRate, 1e-12);
+        CHECK_OIS_COUPON_RESULT("averaged coupon rate", averaged->rate(), averagedRate, 1e-12);
+    };
+
+    checkRates();
+
+    Rate previous = compounded->rate();
+    vars.sofr->addFixing(Date(27, October, 2021), 0.01, true);
+    if (std::fabs(compounded->rate() - previous) < 1e-6)
+        BOOST_ERROR("coupon rate not updated after changing a past fixing");
+    checkRates();
+
+    vars.sofr->addFixing(Date(2, November, 2021), Null<Real>(), true);
+    BOOST_CHECK_EXCEPTION(compounded->rate(), Error,
+                          ExpectedErrorMessage("Missing"));
+    vars.sofr->addFixing(Date(2, November, 2021), 0.0005, true);
+    checkRates();
+}
+
+BOOST_AUTO_TEST_CASE(testLazilyBuiltDates) {
+    BOOST_TEST_MESSAGE("Testing lazily built dates of overnight-indexed coupons...");
+
+    CommonVars vars;
+
+    vars.forecastCurve.linkTo(flatRate(0.0010, Actual360()));
+
+    struct Case {
+        Natural lookbackDays;
+        Natural lockoutDays;
+        bool applyObservationShift;
+    };
+    Case cases[] = {
+        { Null<Natural>(), 0, false },
+        { Null<Natural>(), 2, false },
+        { 2, 0, true },
+        { 2, 3, true }
+    };
+
+    for (const auto& c : cases) {
+        // the coupon ends within the telescopic front stub, so that the
+        // eagerly built telescopic value dates are the full schedule
+        auto lazy = vars.makeCoupon(Date(10, November, 2021), Date(30, November, 2021),
+                                    c.lookbackDays, c.lockoutDays, c.applyObservationShift);
+        auto eager = vars.makeCoupon(Date(10, November, 2021), Date(30, November, 2021),
+                                     c.lookbackDays, c.lockoutDays, c.applyObservationShift,
+                                     true);
+
+        // the inspectors are called in a different order than above
+        BOOST_CHECK_EQUAL(lazy->dt().size() + 1, lazy->valueDates().size());
+        BOOST_CHECK_EQUAL(lazy->fixingDates().size(), lazy->dt().size());
+        BOOST_CHECK_EQUAL(lazy->indexFixings().size(), eager->indexFixings().size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(lazy->valueDates().begin(), lazy->valueDates().end(),
+                                      eager->valueDates().begin(), eager->valueDates().end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(lazy->interestDates().begin(), lazy->interestDates().end(),
+                                      eager->interestDates().begin(), eager->interestDates().end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(lazy->fixingDates().begin(), lazy->fixingDates().end(),
+                                      eager->fixingDates().begin(), eager->fixingDates().end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(lazy->dt().begin(), lazy->dt().end(),
+                                      eager->dt().begin(), eager->dt().end());
+        BOOST_CHECK_EQUAL(lazy->fixingDate(), eager->fixingDate());
+        CHECK_OIS_COUPON_RESULT("coupon rate", lazy->rate(), eager->rate(), 1e-12);
+
+        // a longer coupon only has the front and back of its value dates
+        // when telescopic value dates are used
+        auto longLazy = vars.makeCoupon(Date(10, November, 2021), Date(10, May, 2022),
+                                        c.lookbackDays, c.lockoutDays, c.applyObservationShift);
+        auto telescopic = vars.makeCoupon(Date(10, November, 2021), Date(10, May, 2022),
+                                          c.lookbackDays, c.lockoutDays,
+                                          c.applyObservationShift, true);
+
+        const auto& valueDates = longLazy->valueDates();
+        const auto& telescopicValueDates = telescopic->valueDates();
+        BOOST_CHECK(telescopicValueDates.size() < valueDates.size());
+        BOOST_CHECK(std::includes(valueDates.begin(), valueDates.end(),
+                                  telescopicValueDates.begin(), telescopicValueDates.end()));
+        BOOST_CHECK_EQUAL(telescopicValueDates.front(), valueDates.front());
+        BOOST_CHECK_EQUAL(telescopicValueDates.back(), valueDates.back());
+
+        // without lockout, both schedules fix on the same dates at the
+        // ends; the lockout of the telescopic schedule counts its coarser
+        // periods instead and is not compared
+        const auto& fixingDates = longLazy->fixingDates();
+        const auto& telescopicFixingDates = telescopic->fixingDates();
+        BOOST_CHECK_EQUAL(telescopicFixingDates.front(), fixingDates.front());
+        if (c.lockoutDays == 0)
+            BOOST_CHECK_EQUAL(telescopicFixingDates.back(), fixingDates.back());
+
+        // with observation shift, the coarser periods only approximate
+        // the compounding of the daily ones
+        CHECK_OIS_COUPON_RESULT("telescopic value dates coupon rate",
+                                longLazy->rate(), telescopic->rate(), 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testBookOfCoupons) {
+    BOOST_TEST_MESSAGE("Testing a book of overnight-indexed coupons...");
+
+    CommonVars vars;
+
+    vars.forecastCurve.linkTo(flatRate(0.04, Actual360()));
+
+    const Calendar calendar = vars.sofr->fixingCalendar();
+    const Size n = 300;
+    std::vector<ext::shared_ptr<OvernightIndexedCoupon>> coupons;
+    coupons.reserve(n);
+    for (Size i=0; i<n; ++i) {
+        Date start = calendar.advance(vars.today, Integer(i) + 1, Days);
+        coupons.push_back(vars.makeCoupon(start, calendar.advance(start, 1, Years)));
+    }
+
+    for (Size i=0; i<n; i+=10) {
+        const auto& coupon = coupons[i];
+        Rate expected =
+            (vars.forecastCurve->discount(coupon->accrualStartDate()) /
+             vars.forecastCurve->discount(coupon->accrualEndDate()) - 1.0)
+            / coupon->accrualPeriod();
+        CHECK_OIS_COUPON_RESULT("coupon rate", coupon->rate(), expected, 1e-12);
+
+        // once built, the dates are shared with the copies
+        OvernightIndexedCoupon copy(*coupon);
+        if (&copy.fixingDates() != &coupon->fixingDates()
+            || &copy.valueDates() != &coupon->valueDates()
+            || &copy.interestDates() != &coupon->interestDates()
+            || &copy.dt() != &coupon->dt())
+            BOOST_ERROR("copy of coupon " << i << " doesn't share its dates");
+        CHECK_OIS_COUPON_RESULT("copied coupon rate", copy.rate(), coupon->rate(), 1e-15);
+    }
+}
+
+// Only run by the benchmark (or explicitly); too expensive for the unit suite.
+BOOST_AUTO_TEST_CASE(testLargeBookOfCoupons, *boost::unit_test::disabled()) {
+    BOOST_TEST_MESSAGE("Testing a large book of overnight-indexed coupons...");
+
+    CommonVars vars;
+
+    vars.forecastCurve.linkTo(flatRate(0.04, Actual360()));
+
+    // one-year coupons with different start dates; the daily dates
+    // are only built for the ones being priced
+    const Calendar calendar = vars.sofr->fixingCalendar();
+    const Size n = 100000;
+    std::vector<ext::shared_ptr<OvernightIndexedCoupon>> coupons;
+    coupons.reserve(n);
+    for (Size i=0; i<n; ++i) {
+        Date start = calendar.advance(vars.today, Integer(i % 500) + 1, Days);
+        coupons.push_back(vars.makeCoupon(start, calendar.advance(start, 1, Years)));
+    }
+
+    for (Size i=0; i<n; i+=1000) {
+        const auto& coupon = coupons[i];
+        Rate expected =
+            (vars.forecastCurve->discount(coupon->accrualStartDate()) /
+             vars.forecastCurve->discount(coupon->accrualEndDate()) - 1.0)
+            / coupon->accrualPeriod();
+        CHECK_OIS_COUPON_RESULT("coupon rate", coupon->rate(), expected, 1e-12);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
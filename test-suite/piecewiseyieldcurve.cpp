@@ -21,6 +21,8 @@
 #include "toplevelfixture.hpp"
 #include "utilities.hpp"
 #include <ql/cashflows/iborcoupon.hpp>
+#include <ql/experimental/risk/bucketedsensitivityengine.hpp>
+#include <ql/experimental/risk/scenarioengine.hpp>
 #include <ql/experimental/termstructures/basisswapratehelpers.hpp>
 #include <ql/indexes/bmaindex.hpp>
 #include <ql/indexes/ibor/estr.hpp>
@@ -65,6 +67,7 @@
 #include <ql/utilities/dataformatters.hpp>
 #include <iomanip>
 #include <map>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -2261,6 +2264,179 @@ BOOST_AUTO_TEST_CASE(testDatedSwapHelpers) {
     }
 }
 
+namespace {
+
+    const std::vector<Rate> swapPortfolioRates = { 0.030, 0.031, 0.032, 0.033, 0.035, 0.036 };
+
+    // a deposit and swap curve and a few swaps priced on it
+    PortfolioMarket swapPortfolioMarket() {
+        std::vector<Period> depositTenors = { 3 * Months, 6 * Months };
+        std::vector<Period> swapTenors = { 2 * Years, 5 * Years, 10 * Years, 20 * Years };
+        std::vector<Period> portfolioTenors = { 3 * Years, 7 * Years, 15 * Years };
+
+        PortfolioMarket market;
+        RelinkableHandle<YieldTermStructure> curveHandle;
+        auto index = ext::make_shared<Euribor6M>(curveHandle);
+        std::vector<ext::shared_ptr<RateHelper> > helpers;
+        for (Size i=0; i<swapPortfolioRates.size(); ++i) {
+            auto quote = ext::make_shared<SimpleQuote>(swapPortfolioRates[i]);
+            market.quotes.push_back(quote);
+            if (i < depositTenors.size())
+                helpers.push_back(ext::make_shared<DepositRateHelper>(
+                    Handle<Quote>(quote), depositTenors[i], 2, TARGET(),
+                    ModifiedFollowing, true, Actual360()));
+            else
+                helpers.push_back(ext::make_shared<SwapRateHelper>(
+                    Handle<Quote>(quote), swapTenors[i - depositTenors.size()],
+                    TARGET(), Annual, Unadjusted, Thirty360(Thirty360::BondBasis),
+                    ext::make_shared<Euribor6M>()));
+        }
+        curveHandle.linkTo(ext::make_shared<PiecewiseYieldCurve<Discount, LogLinear> >(
+            Settings::instance().evaluationDate(), helpers, Actual365Fixed()));
+        for (const auto& tenor : portfolioTenors) {
+            ext::shared_ptr<VanillaSwap> swap =
+                MakeVanillaSwap(tenor, index, 0.034)
+                .withDiscountingTermStructure(curveHandle)
+                .withNominal(1000000.0);
+            market.instruments.push_back(swap);
+        }
+        return market;
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE(testBucketedSensitivities) {
+    BOOST_TEST_MESSAGE("Testing bucketed sensitivities of a swap portfolio...");
+
+    Settings::instance().evaluationDate() = Date(15, March, 2024);
+
+    const auto& rates = swapPortfolioRates;
+    auto buildMarket = swapPortfolioMarket;
+
+    Real shift = 1.0e-4;
+    auto results = BucketedSensitivityEngine(buildMarket, shift).calculate();
+
+    // bump-and-revalue on a separate copy of the market; the
+    // tolerances account for the accuracy of the bootstrap, since
+    // the curves are re-bootstrapped starting from different guesses
+    auto market = buildMarket();
+    Real deltaTolerance = 1.0e-2, gammaTolerance = 1.0e3;
+    for (Size j=0; j<rates.size(); ++j) {
+        market.quotes[j]->setValue(rates[j] + shift);
+        std::vector<Real> up;
+        for (const auto& instrument : market.instruments)
+            up.push_back(instrument->NPV());
+        market.quotes[j]->setValue(rates[j] - shift);
+        for (Size i=0; i<market.instruments.size(); ++i) {
+            Real expected = (up[i] - market.instruments[i]->NPV()) / (2.0 * shift);
+            if (std::fabs(results.delta[i][j] - expected) > deltaTolerance)
+                BOOST_ERROR("failed to reproduce delta of swap #" << i
+                            << " to quote #" << j << ":"
+                            << "\n    calculated: " << results.delta[i][j]
+                            << "\n    expected:   " << expected);
+        }
+        market.quotes[j]->setValue(rates[j]);
+    }
+
+    for (Size i=0; i<market.instruments.size(); ++i) {
+        Real sum = 0.0;
+        for (Size j=0; j<rates.size(); ++j)
+            sum += results.delta[i][j];
+        if (std::fabs(results.parallelDelta[i] - sum) > 1.0e-3 * std::fabs(sum))
+            BOOST_ERROR("parallel delta of swap #" << i
+                        << " inconsistent with bucketed deltas:"
+                        << "\n    parallel delta:       " << results.parallelDelta[i]
+                        << "\n    sum of bucket deltas: " << sum);
+    }
+
+    // the results must not depend on the number of market copies
+    for (Size markets : { 2, 4, 8 }) {
+        auto parallel = BucketedSensitivityEngine(buildMarket, shift,
+                                                  BucketedSensitivityEngine::Centered,
+                                                  markets).calculate();
+        for (Size i=0; i<market.instruments.size(); ++i) {
+            for (Size j=0; j<rates.size(); ++j) {
+                if (std::fabs(parallel.delta[i][j] - results.delta[i][j]) > deltaTolerance ||
+                    std::fabs(parallel.gamma[i][j] - results.gamma[i][j]) > gammaTolerance)
+                    BOOST_ERROR("sensitivities of swap #" << i << " to quote #" << j
+                                << " depend on the number of market copies:"
+                                << "\n    copies:     " << markets
+                                << "\n    delta:      " << parallel.delta[i][j]
+                                << "\n    expected:   " << results.delta[i][j]
+                                << "\n    gamma:      " << parallel.gamma[i][j]
+                                << "\n    expected:   " << results.gamma[i][j]);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testScenarioRevaluation) {
+    BOOST_TEST_MESSAGE("Testing scenario revaluation of a swap portfolio...");
+
+    Settings::instance().evaluationDate() = Date(15, March, 2024);
+
+    const auto& rates = swapPortfolioRates;
+    auto buildMarket = swapPortfolioMarket;
+
+    Size numberOfScenarios = 50;
+    Matrix scenarios(numberOfScenarios, rates.size());
+    for (Size s=0; s<numberOfScenarios; ++s)
+        for (Size j=0; j<rates.size(); ++j)
+            scenarios[s][j] = 0.0005 * std::sin(Real(3*s + 5*j + 1));
+
+    // revaluation on a separate copy of the market
+    auto market = buildMarket();
+    std::vector<std::vector<Real> > expected(numberOfScenarios);
+    for (Size s=0; s<numberOfScenarios; ++s) {
+        for (Size j=0; j<rates.size(); ++j)
+            market.quotes[j]->setValue(rates[j] + scenarios[s][j]);
+        for (const auto& instrument : market.instruments)
+            expected[s].push_back(instrument->NPV());
+    }
+
+    Real tolerance = 1.0e-4;
+    for (Size markets : { 1, 3 }) {
+        Size nextScenario = 0;
+        ScenarioEngine engine(buildMarket, ScenarioEngine::Absolute, markets, 7);
+        engine.calculate(scenarios, [&](Size s, const std::vector<Real>& values) {
+            if (s != nextScenario++)
+                BOOST_FAIL("scenario #" << s << " returned out of order");
+            for (Size i=0; i<values.size(); ++i) {
+                if (std::fabs(values[i] - expected[s][i]) > tolerance)
+                    BOOST_ERROR("failed to reproduce value of swap #" << i
+                                << " in scenario #" << s << ":"
+                                << "\n    copies:     " << markets
+                                << "\n    calculated: " << values[i]
+                                << "\n    expected:   " << expected[s][i]);
+            }
+        });
+        if (nextScenario != numberOfScenarios)
+            BOOST_ERROR(nextScenario << " scenarios returned instead of "
+                        << numberOfScenarios);
+    }
+
+    Real baseValue = 0.0;
+    for (Size j=0; j<rates.size(); ++j)
+        market.quotes[j]->setValue(rates[j]);
+    for (const auto& instrument : market.instruments)
+        baseValue += instrument->NPV();
+    Real expectedMean = 0.0;
+    for (Size s=0; s<numberOfScenarios; ++s)
+        expectedMean += std::accumulate(expected[s].begin(), expected[s].end(), -baseValue);
+    expectedMean /= numberOfScenarios;
+
+    RiskStatistics pnl = ScenarioEngine(buildMarket, ScenarioEngine::Absolute, 2)
+                         .profitAndLoss(scenarios);
+    if (pnl.samples() != numberOfScenarios)
+        BOOST_ERROR("wrong number of P&L samples:"
+                    << "\n    calculated: " << pnl.samples()
+                    << "\n    expected:   " << numberOfScenarios);
+    if (std::fabs(pnl.mean() - expectedMean) > tolerance)
+        BOOST_ERROR("failed to reproduce mean P&L:"
+                    << "\n    calculated: " << pnl.mean()
+                    << "\n    expected:   " << expectedMean);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
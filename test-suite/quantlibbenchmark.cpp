@@ -497,6 +497,8 @@ QL_BENCHMARK_DECLARE(HestonModelTests, testDAXCalibration, 1, 0.5);
 QL_BENCHMARK_DECLARE(HestonModelTests, testFdBarrierVsCached, 1, 3.0);
 QL_BENCHMARK_DECLARE(HestonModelTests, testFdAmerican, 1, 1.0);
 QL_BENCHMARK_DECLARE(HestonModelTests, testLocalVolFromHestonModel, 10, 1.0);
+QL_BENCHMARK_DECLARE(HestonModelTests, testChainPricing, 10, 0.5);
+QL_BENCHMARK_DECLARE(HestonModelTests, testFFTEngineOnSurface, 1, 1.0);
 QL_BENCHMARK_DECLARE(FdHestonTests, testFdmHestonAmerican, 10, 1.0);
 QL_BENCHMARK_DECLARE(FdHestonTests, testAmericanCallPutParity, 15, 1.5);
 QL_BENCHMARK_DECLARE(FdHestonTests, testFdmHestonBarrierVsBlackScholes, 1, 2.0);
@@ -519,6 +521,8 @@ QL_BENCHMARK_DECLARE(AndreasenHugeVolatilityInterplTests, testLinearInterpolatio
 QL_BENCHMARK_DECLARE(ShortRateModelTests, testSwaps, 30, 3.0);
 QL_BENCHMARK_DECLARE(ShortRateModelTests, testCachedHullWhite2, 500, 1.0);
 QL_BENCHMARK_DECLARE(ShortRateModelTests, testCachedHullWhiteFixedReversion, 1000, 1.0);
+QL_BENCHMARK_DECLARE(MarketModelTests, testParallelAccountingEngine, 1, 2.0);
+QL_BENCHMARK_DECLARE(MarketModelTests, testReducedFactorDriftCalculators, 10, 1.0);
 QL_BENCHMARK_DECLARE(MarketModelCmsTests, testMultiStepCmSwapsAndSwaptions, 1, 11.0);
 QL_BENCHMARK_DECLARE(MarketModelSmmTests, testMultiStepCoterminalSwapsAndSwaptions, 1, 9.0);
 QL_BENCHMARK_DECLARE(BermudanSwaptionTests, testCachedG2Values, 1, 2.0);
@@ -531,6 +535,7 @@ QL_BENCHMARK_DECLARE(PiecewiseYieldCurveTests, testGlobalBootstrap, 20, 2.0);
 QL_BENCHMARK_DECLARE(OvernightIndexedSwapTests, testBootstrapWithArithmeticAverage, 10, 5.0);
 QL_BENCHMARK_DECLARE(OvernightIndexedSwapTests, testBaseBootstrap, 10, 3.0);
 QL_BENCHMARK_DECLARE(OvernightIndexedSwapTests, testBootstrapRegression, 10, 1.0);
+QL_BENCHMARK_DECLARE(OvernightIndexedCouponTests, testLargeBookOfCoupons, 1, 2.0);
 QL_BENCHMARK_DECLARE(MarkovFunctionalTests, testCalibrationTwoInstrumentSets, 1, 3.0);
 QL_BENCHMARK_DECLARE(MarkovFunctionalTests, testCalibrationOneInstrumentSet, 1, 4.0);
 QL_BENCHMARK_DECLARE(MarkovFunctionalTests, testVanillaEngines, 1, 7.0);
@@ -538,6 +543,7 @@ QL_BENCHMARK_DECLARE(MarkovFunctionalTests, testBermudanSwaption, 3, 1.0);
 QL_BENCHMARK_DECLARE(SwaptionVolatilityCubeTests, testSpreadedCube, 20, 1.0);
 QL_BENCHMARK_DECLARE(SwaptionVolatilityCubeTests, testSabrNormalVolatility, 1, 1.0);
 QL_BENCHMARK_DECLARE(SwaptionVolatilityCubeTests, testSabrVols, 30, 1.0);
+QL_BENCHMARK_DECLARE(SwaptionVolatilityCubeTests, testCmsLegOnSmileGrid, 1, 2.0);
 QL_BENCHMARK_DECLARE(ZabrTests, testConsistency, 1, 10.0);
 QL_BENCHMARK_DECLARE(CmsSpreadTests, testCouponPricing, 1, 1.0);
 QL_BENCHMARK_DECLARE(CmsTests, testCmsSwap, 20, 2.0);
@@ -578,6 +584,8 @@ QL_BENCHMARK_DECLARE(RoundingTests, testUp, 100000, 0.1);
 QL_BENCHMARK_DECLARE(RoundingTests, testFloor, 100000, 0.1);
 QL_BENCHMARK_DECLARE(RoundingTests, testDown, 100000, 0.1);
 QL_BENCHMARK_DECLARE(RoundingTests, testClosest, 100000, 0.1);
+QL_BENCHMARK_DECLARE(InterpolationTests, testBatchedEvaluation, 50, 0.5);
+QL_BENCHMARK_DECLARE(InterpolationTests, testBatchedEvaluationOnLargeGrid, 20, 0.5);
 
 
 
@@ -1292,6 +1292,61 @@ BOOST_AUTO_TEST_CASE(testBackwardRegularFirstPeriodWithFirstDate) {
         "Period ending at off-grid nextToLastDate should be irregular");
 }
 
+BOOST_AUTO_TEST_CASE(testScheduleCache) {
+    BOOST_TEST_MESSAGE("Testing schedule cache...");
+
+    ScheduleCache cache;
+    const Date start(17, January, 2024);
+    const Period tenors[] = { 3*Months, 6*Months, 1*Years };
+    const DateGeneration::Rule rules[] = { DateGeneration::Backward,
+                                           DateGeneration::Forward };
+
+    for (Integer trade=0; trade<2; ++trade) {
+        for (const Period& tenor : tenors) {
+            for (DateGeneration::Rule rule : rules) {
+                for (Integer years=1; years<=10; ++years) {
+                    Schedule expected = MakeSchedule()
+                        .from(start).to(start + years*Years)
+                        .withTenor(tenor).withCalendar(TARGET())
+                        .withConvention(ModifiedFollowing)
+                        .withRule(rule);
+                    Schedule cached = MakeSchedule()
+                        .from(start).to(start + years*Years)
+                        .withTenor(tenor).withCalendar(TARGET())
+                        .withConvention(ModifiedFollowing)
+                        .withRule(rule)
+                        .withCache(cache);
+                    check_dates(cached, expected.dates());
+                    BOOST_CHECK(cached.isRegular() == expected.isRegular());
+                    BOOST_CHECK_EQUAL(cached.rule(), expected.rule());
+                }
+            }
+        }
+    }
+    // the second round of trades is served from the cache
+    BOOST_CHECK_EQUAL(cache.size(), Size(3*2*10));
+
+    // cached schedules share their dates
+    Schedule s1 = cache.schedule(start, start + 5*Years, 6*Months, TARGET(),
+                                 ModifiedFollowing, ModifiedFollowing,
+                                 DateGeneration::Backward, false);
+    Schedule s2 = cache.schedule(start, start + 5*Years, 6*Months, TARGET(),
+                                 ModifiedFollowing, ModifiedFollowing,
+                                 DateGeneration::Backward, false);
+    BOOST_CHECK(&s1.dates() == &s2.dates());
+
+    // a different calendar gives a different schedule
+    Schedule s3 = cache.schedule(start, start + 5*Years, 6*Months,
+                                 UnitedStates(UnitedStates::GovernmentBond),
+                                 ModifiedFollowing, ModifiedFollowing,
+                                 DateGeneration::Backward, false);
+    BOOST_CHECK(&s1.dates() != &s3.dates());
+    BOOST_CHECK_EQUAL(cache.size(), Size(3*2*10 + 1));
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), Size(0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,7 @@
 #include "toplevelfixture.hpp"
 #include "utilities.hpp"
 #include <ql/cashflows/iborcoupon.hpp>
+#include <ql/discretizedasset.hpp>
 #include <ql/models/shortrate/onefactormodels/hullwhite.hpp>
 #include <ql/models/shortrate/onefactormodels/vasicek.hpp>
 #include <ql/models/shortrate/onefactormodels/extendedcoxingersollross.hpp>
@@ -493,6 +494,55 @@ BOOST_AUTO_TEST_CASE(testVasicekDiscountFactorForSmallMeanReversion) {
                     << "\n  tolerance : " << tolerance);
     }
 }
+
+BOOST_AUTO_TEST_CASE(testDiscountBondRollbackOnTree) {
+    BOOST_TEST_MESSAGE("Testing discount-bond rollback on a Hull-White tree...");
+
+    const Date today = Settings::instance().evaluationDate();
+
+    const Handle<YieldTermStructure> rTS(
+        flatRate(today, 0.04, Actual365Fixed()));
+    HullWhite model(rTS, 0.1, 0.01);
+
+    const Time maturity = 10.0;
+    auto tree = ext::dynamic_pointer_cast<OneFactorModel::ShortRateTree>(
+        model.tree(TimeGrid(maturity, 500)));
+
+    DiscretizedDiscountBond bond;
+    bond.initialize(tree, maturity);
+    bond.rollback(0.0);
+
+    Real calculated = bond.values()[0];
+    Real expected = rTS->discount(maturity);
+    Real tolerance = 1.0e-6;
+    if (std::fabs(calculated - expected) > tolerance) {
+        BOOST_ERROR("failed to reproduce discount bond price on tree:"
+                    << std::setprecision(10)
+                    << "\n  calculated: " << calculated
+                    << "\n  expected  : " << expected
+                    << std::scientific
+                    << "\n  difference: " << calculated - expected);
+    }
+
+    // a constant spread discounts the bond deterministically
+    const Spread spread = 0.01;
+    tree->setSpread(spread);
+    bond.initialize(tree, maturity);
+    bond.rollback(0.0);
+
+    Real withSpread = bond.values()[0];
+    expected = calculated * std::exp(-spread*maturity);
+    tolerance = 1.0e-12;
+    if (std::fabs(withSpread - expected) > tolerance) {
+        BOOST_ERROR("failed to reproduce discount bond price with spread:"
+                    << std::setprecision(10)
+                    << "\n  calculated: " << withSpread
+                    << "\n  expected  : " << expected
+                    << std::scientific
+                    << "\n  difference: " << withSpread - expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,9 @@
 #include "toplevelfixture.hpp"
 #include "swaptionvolstructuresutilities.hpp"
 #include "utilities.hpp"
+#include <ql/cashflows/cmscoupon.hpp>
+#include <ql/cashflows/conundrumpricer.hpp>
+#include <ql/cashflows/couponpricer.hpp>
 #include <ql/indexes/swap/euriborswap.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <ql/termstructures/volatility/swaption/interpolatedswaptionvolatilitycube.hpp>
@@ -31,7 +34,10 @@
 #include <ql/termstructures/volatility/swaption/spreadedswaptionvol.hpp>
 #include <ql/termstructures/volatility/sabrsmilesection.hpp>
 #include <ql/termstructures/volatility/zabrsmilesection.hpp>
+#include <ql/time/calendars/target.hpp>
+#include <ql/time/schedule.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <iomanip>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -591,6 +597,223 @@ BOOST_AUTO_TEST_CASE(testSabrParameters) {
 
 }
 
+BOOST_AUTO_TEST_CASE(testSabrRecalibration) {
+    BOOST_TEST_MESSAGE("Testing recalibration of SABR cube after a market move...");
+
+    CommonVars vars;
+
+    std::vector<std::vector<Handle<Quote> > >
+        parametersGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (auto& guess : parametersGuess) {
+        guess = {
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.2)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.5)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.4)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.0))
+        };
+    }
+    std::vector<bool> isParameterFixed(4, false);
+
+    auto makeCube = [&](bool warmStart) {
+        return ext::make_shared<SabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle,
+            vars.swapIndexBase, vars.shortSwapIndexBase,
+            vars.vegaWeighedSmileFit, parametersGuess, isParameterFixed, true,
+            ext::shared_ptr<EndCriteria>(), Null<Real>(),
+            ext::shared_ptr<OptimizationMethod>(), Null<Real>(),
+            false, 50, false, 0.0001, warmStart);
+    };
+
+    auto checkSameParameters = [](const Matrix& calculated, const Matrix& expected) {
+        for (Size i=0; i<expected.rows(); ++i) {
+            for (Size j=0; j<expected.columns(); ++j) {
+                if (std::fabs(calculated[i][j] - expected[i][j]) > 1e-15)
+                    BOOST_FAIL("recalibrated parameters differ from new calibration:"
+                               << "\n    row:        " << i
+                               << "\n    column:     " << j
+                               << "\n    calculated: " << calculated[i][j]
+                               << "\n    expected:   " << expected[i][j]);
+            }
+        }
+    };
+
+    auto cube = makeCube(false);
+    auto warmCube = makeCube(true);
+    checkSameParameters(warmCube->sparseSabrParameters(), cube->sparseSabrParameters());
+
+    // move a single smile
+    Size smile = 4, strike = 0;
+    Spread bump = 0.0005;
+    ext::dynamic_pointer_cast<SimpleQuote>(
+        vars.cube.volSpreadsHandle[smile][strike].currentLink())->setValue(
+            vars.cube.volSpreads[smile][strike] + bump);
+    vars.cube.volSpreads[smile][strike] += bump;
+
+    // the smiles that didn't move are not recalibrated, but the
+    // results are the same as for a new cube
+    auto newCube = makeCube(false);
+    checkSameParameters(cube->sparseSabrParameters(), newCube->sparseSabrParameters());
+    checkSameParameters(cube->denseSabrParameters(), newCube->denseSabrParameters());
+
+    // warm-started calibrations might converge to slightly different
+    // points, but must still fit the market
+    vars.makeAtmVolTest(*warmCube, 3.0e-4);
+    vars.makeVolSpreadsTest(*warmCube, 12.0e-4);
+}
+
+BOOST_AUTO_TEST_CASE(testSmileGrid) {
+
+    BOOST_TEST_MESSAGE("Testing smile sections with precomputed volatilities...");
+
+    CommonVars vars;
+
+    std::vector<std::vector<Handle<Quote> > >
+        sabrGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (auto& guess : sabrGuess) {
+        guess = {
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.2)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.5)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.4)),
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.0))
+        };
+    }
+    auto zabrGuess = vars.makeZabrParametersGuess(0.2, 0.5, 0.4, 0.0, 0.75);
+    std::vector<bool> sabrFixed(4, false), zabrFixed(5, false);
+    zabrFixed[1] = zabrFixed[4] = true;
+
+    auto makeSabrCube = [&](Size gridSize) {
+        return ext::make_shared<SabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle,
+            vars.swapIndexBase, vars.shortSwapIndexBase,
+            vars.vegaWeighedSmileFit, sabrGuess, sabrFixed, true,
+            ext::shared_ptr<EndCriteria>(), Null<Real>(),
+            ext::shared_ptr<OptimizationMethod>(), Null<Real>(),
+            false, 50, false, 0.0001, false, gridSize);
+    };
+    auto makeZabrCube = [&](Size gridSize) {
+        return ext::make_shared<ZabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle,
+            vars.swapIndexBase, vars.shortSwapIndexBase,
+            vars.vegaWeighedSmileFit, zabrGuess, zabrFixed, true,
+            ext::shared_ptr<EndCriteria>(), Null<Real>(),
+            ext::shared_ptr<OptimizationMethod>(), Null<Real>(),
+            false, 50, false, 0.0001, false, gridSize);
+    };
+
+    auto checkSmiles = [](const SwaptionVolatilityStructure& exact,
+                          const SwaptionVolatilityStructure& interpolated,
+                          Real tolerance, const std::string& model) {
+        for (const Period& option : {Period(1, Years), Period(5, Years)}) {
+            ext::shared_ptr<SmileSection> exactSection =
+                exact.smileSection(option, Period(10, Years));
+            ext::shared_ptr<SmileSection> interpolatedSection =
+                interpolated.smileSection(option, Period(10, Years));
+            Rate forward = exactSection->atmLevel();
+            for (Real moneyness = 0.5; moneyness <= 2.0; moneyness += 0.05) {
+                Rate strike = forward * moneyness;
+                Volatility expected = exactSection->volatility(strike);
+                Volatility calculated = interpolatedSection->volatility(strike);
+                if (std::fabs(calculated - expected) > tolerance)
+                    BOOST_ERROR("failed to interpolate " << model << " smile:"
+                                << "\n    option tenor: " << option
+                                << "\n    strike:       " << io::rate(strike)
+                                << "\n    exact:        " << expected
+                                << "\n    interpolated: " << calculated
+                                << "\n    tolerance:    " << tolerance);
+                // single volatilities don't use the grid
+                if (interpolated.volatility(option, Period(10, Years), strike) !=
+                    exact.volatility(option, Period(10, Years), strike))
+                    BOOST_ERROR("unexpected " << model << " volatility at strike "
+                                << io::rate(strike));
+            }
+        }
+    };
+
+    checkSmiles(*makeSabrCube(0), *makeSabrCube(200), 1.0e-7, "SABR");
+    checkSmiles(*makeZabrCube(0), *makeZabrCube(200), 1.0e-5, "ZABR");
+}
+
+BOOST_AUTO_TEST_CASE(testCmsLegOnSmileGrid) {
+
+    BOOST_TEST_MESSAGE("Testing CMS coupons on smile sections with precomputed volatilities...");
+
+    CommonVars vars;
+
+    auto sabrGuess = vars.makeZabrParametersGuess(0.2, 0.5, 0.4, 0.0, 1.0);
+    for (auto& guess : sabrGuess)
+        guess.pop_back();
+    auto zabrGuess = vars.makeZabrParametersGuess(0.2, 0.5, 0.4, 0.0, 0.75);
+    std::vector<bool> sabrFixed(4, false), zabrFixed(5, false);
+    zabrFixed[1] = zabrFixed[4] = true;
+
+    auto makeSabrCube = [&](Size gridSize) {
+        Handle<SwaptionVolatilityStructure> cube(ext::make_shared<SabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle,
+            vars.swapIndexBase, vars.shortSwapIndexBase,
+            vars.vegaWeighedSmileFit, sabrGuess, sabrFixed, true,
+            ext::shared_ptr<EndCriteria>(), Null<Real>(),
+            ext::shared_ptr<OptimizationMethod>(), Null<Real>(),
+            false, 50, false, 0.0001, false, gridSize));
+        cube->enableExtrapolation();
+        return cube;
+    };
+    auto makeZabrCube = [&](Size gridSize) {
+        Handle<SwaptionVolatilityStructure> cube(ext::make_shared<ZabrSwaptionVolatilityCube>(
+            vars.atmVolMatrix, vars.cube.tenors.options, vars.cube.tenors.swaps,
+            vars.cube.strikeSpreads, vars.cube.volSpreadsHandle,
+            vars.swapIndexBase, vars.shortSwapIndexBase,
+            vars.vegaWeighedSmileFit, zabrGuess, zabrFixed, true,
+            ext::shared_ptr<EndCriteria>(), Null<Real>(),
+            ext::shared_ptr<OptimizationMethod>(), Null<Real>(),
+            false, 50, false, 0.0001, false, gridSize));
+        cube->enableExtrapolation();
+        return cube;
+    };
+
+    // 20-year annual CMS leg
+    auto swapIndex = ext::make_shared<EuriborSwapIsdaFixA>(10*Years, vars.termStructure);
+    Date startDate = vars.termStructure->referenceDate() + 1*Years;
+    Schedule schedule(startDate, startDate + 20*Years, 1*Years,
+                      TARGET(), ModifiedFollowing, ModifiedFollowing,
+                      DateGeneration::Forward, false);
+    Leg leg = CmsLeg(schedule, swapIndex).withNotionals(1.0);
+    Handle<Quote> meanReversion(ext::make_shared<SimpleQuote>(0.01));
+
+    auto amounts = [&](const Handle<SwaptionVolatilityStructure>& volatility) {
+        setCouponPricer(leg, ext::make_shared<NumericHaganPricer>(
+                                 volatility, GFunctionFactory::Standard, meanReversion));
+        std::vector<Real> result;
+        for (const auto& cf : leg)
+            result.push_back(cf->amount());
+        return result;
+    };
+
+    auto checkAmounts = [&](const Handle<SwaptionVolatilityStructure>& exact,
+                            const Handle<SwaptionVolatilityStructure>& interpolated,
+                            const std::string& model) {
+        std::vector<Real> expected = amounts(exact);
+        std::vector<Real> calculated = amounts(interpolated);
+        const Real tolerance = 1.0e-6;
+        for (Size i=0; i<leg.size(); ++i) {
+            if (std::fabs(calculated[i] - expected[i]) > tolerance)
+                BOOST_ERROR("failed to reproduce CMS coupon amount on " << model
+                            << " smile grid:"
+                            << "\n    payment date: " << leg[i]->date()
+                            << std::setprecision(10)
+                            << "\n    expected:     " << expected[i]
+                            << "\n    calculated:   " << calculated[i]
+                            << "\n    tolerance:    " << tolerance);
+        }
+    };
+
+    checkAmounts(makeSabrCube(0), makeSabrCube(100), "SABR");
+    checkAmounts(makeZabrCube(0), makeZabrCube(100), "ZABR");
+}
+
 BOOST_AUTO_TEST_CASE(testZabrVols) {
 
     BOOST_TEST_MESSAGE("Testing swaption volatility cube (ZABR interpolation)...");